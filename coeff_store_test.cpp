@@ -0,0 +1,66 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+
+using namespace lbcrypto;
+
+// 계수 평문 캐시 테스트: 음수 계수가 있는 다항식을 CoeffStore 를 거쳐 암호공간에서 평가하고
+// 평문 정수 파이프라인(eval_scaled_plain) 결과와 슬롯별로 비교한다.
+int main() {
+    const int64_t PlaintextModulus = 65537;
+
+    // 음수 상수항 / 음수 홀수 계수가 섞인 다항식과 5차 테일러 sin (ic3 < 0)
+    ScaledPolynomial mixed;
+    mixed.coeffs = {-7, 3, -5, 2};
+    const std::vector<ScaledPolynomial> polys = {mixed, make_taylor_sin(5, 3, 120)};
+
+    size_t max_degree = 0;
+    for (const auto& poly : polys) max_degree = std::max(max_degree, poly.degree());
+
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(required_depth(max_degree));
+    parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(4096);
+
+    std::cout << "========== 계수 평문 캐시 테스트 시작 ==========\n";
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+
+    std::vector<int64_t> inputs;
+    for (int64_t x = -9; x <= 9; x++) inputs.push_back(x);
+    auto ct_x = encrypt_batch(cc, keyPair.publicKey, inputs);
+
+    auto coeffs = std::make_shared<CoeffStore>(cc);
+    size_t failures = 0;
+    for (size_t p = 0; p < polys.size(); p++) {
+        PolyEvaluator evaluator(cc, coeffs);
+        std::vector<Ciphertext<DCRTPoly>> ct_y;
+        for (const auto& ct : ct_x) ct_y.push_back(evaluator.evaluate(ct, polys[p]));
+        auto outputs = decrypt_batch(cc, keyPair.secretKey, ct_y, inputs.size());
+
+        size_t mismatch = 0;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            const int64_t expected = eval_scaled_plain(polys[p], inputs[i], PlaintextModulus);
+            if (outputs[i] != expected) {
+                if (mismatch == 0) {
+                    std::cout << "  x=" << inputs[i] << ": 암호공간 " << outputs[i] << ", 평문 " << expected << "\n";
+                }
+                mismatch++;
+            }
+        }
+        std::cout << "다항식 " << p << " (" << polys[p].degree() << "차): 불일치 " << mismatch << " / "
+                  << inputs.size() << (mismatch == 0 ? " O" : " X") << "\n";
+        failures += mismatch;
+    }
+    std::cout << "캐시 적중 " << coeffs->hits() << ", 미스 " << coeffs->misses() << "\n";
+    std::cout << "==============================\n";
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+#include <openfhe/pke/openfhe.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_encrypt_pool.h"
+#include "he_pipeline.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./encrypt_pool_bench [--requests 200] [--capacity 64] [--threads 1] [--low 8] [--rate 100]
+//                             [--depth 5] [--t 593779228673] [--ring 16384]
+// 온라인 암호화 지연 (값 하나, 슬롯 0) 을 세 가지로 비교한다.
+// 1) 직접: MakePackedPlaintext + Encrypt
+// 2) 풀(예열): 미리 채운 풀에서 Enc(0) + pt, 보충 스레드 없음
+// 3) 풀(지속): 보충 스레드를 켜고 --rate 요청/초 로 꺼내 쓸 때 (0 이면 쉬지 않고)
+namespace {
+
+struct LatencyRow {
+    std::vector<double> ms;
+    size_t wrong = 0;  // 복호화 값이 입력과 다른 수
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int64_t requests_arg = arg_int(argc, argv, "--requests", 200);
+    if (requests_arg < 1) {
+        std::cerr << "--requests 는 1 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    const size_t requests = requests_arg;
+    const double rate = arg_double(argc, argv, "--rate", 100.0);
+
+    EncryptPoolConfig pool_config;
+    pool_config.capacity = arg_int(argc, argv, "--capacity", 64);
+    pool_config.refill_threads = arg_int(argc, argv, "--threads", 1);
+    pool_config.low_watermark = arg_int(argc, argv, "--low", 8);
+
+    // ====== 파라미터 (sin_taylor_fifth 와 같은 컨텍스트) ======
+    const int64_t PlaintextModulus = arg_int(argc, argv, "--t", 593779228673);
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(arg_int(argc, argv, "--depth", 5));
+    parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(arg_int(argc, argv, "--ring", 16384));
+
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+
+    auto value_of = [](size_t i) { return static_cast<int64_t>(i % 157) - 78; };
+    auto check = [&](const Ciphertext<DCRTPoly>& ct, int64_t expected) {
+        Plaintext p;
+        cc->Decrypt(keyPair.secretKey, ct, &p);
+        p->SetLength(1);
+        return centered_mod(p->GetPackedValue()[0], PlaintextModulus) == expected;
+    };
+
+    // ====== 1) 직접 암호화 ======
+    LatencyRow direct;
+    for (size_t i = 0; i < requests; i++) {
+        auto start = Clock::now();
+        auto ct = cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext({value_of(i)}));
+        direct.ms.push_back(elapsed_ms(start, Clock::now()));
+        if (!check(ct, value_of(i))) direct.wrong++;
+    }
+
+    // ====== 2) 예열한 풀 (보충 없음, 요청 수만큼 채움) ======
+    LatencyRow warm;
+    {
+        EncryptPoolConfig warm_config = pool_config;
+        warm_config.capacity = requests;
+        warm_config.refill_threads = 0;
+        EncryptPool pool(cc, keyPair.publicKey, warm_config);
+        auto start_fill = Clock::now();
+        pool.fill();
+        std::cout << "풀 예열: Enc(0) " << requests << "개, " << elapsed_ms(start_fill, Clock::now()) << " ms" << std::endl;
+        for (size_t i = 0; i < requests; i++) {
+            auto start = Clock::now();
+            auto ct = pool.encrypt(cc->MakePackedPlaintext({value_of(i)}));
+            warm.ms.push_back(elapsed_ms(start, Clock::now()));
+            if (!check(ct, value_of(i))) warm.wrong++;
+        }
+    }
+
+    // ====== 3) 보충 스레드를 켠 지속 사용 ======
+    LatencyRow sustained;
+    EncryptPoolStats sustained_stats;
+    {
+        size_t alarm_events = 0;
+        EncryptPool pool(cc, keyPair.publicKey, pool_config, [&](size_t remaining) {
+            if (alarm_events++ < 5) std::cout << "  [알람] 풀 남은 개수 " << remaining << " < " << pool_config.low_watermark << std::endl;
+        });
+        pool.fill();
+        const auto interval = std::chrono::duration<double, std::milli>(rate > 0.0 ? 1000.0 / rate : 0.0);
+        auto next = Clock::now();
+        for (size_t i = 0; i < requests; i++) {
+            if (rate > 0.0) {
+                std::this_thread::sleep_until(next);
+                next += std::chrono::duration_cast<Clock::duration>(interval);
+            }
+            auto start = Clock::now();
+            auto ct = pool.encrypt(cc->MakePackedPlaintext({value_of(i)}));
+            sustained.ms.push_back(elapsed_ms(start, Clock::now()));
+            if (!check(ct, value_of(i))) sustained.wrong++;
+        }
+        sustained_stats = pool.stats();
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "\n=== 온라인 암호화 지연 (ms, 요청 " << requests << "개) ===" << std::endl;
+    std::cout << "방식\tp50\tp99\t최대\t복호화 불일치" << std::endl;
+    for (auto* row : {&direct, &warm, &sustained}) {
+        std::sort(row->ms.begin(), row->ms.end());
+    }
+    auto print_row = [](const std::string& name, const LatencyRow& row) {
+        std::cout << name << "\t" << percentile(row.ms, 50.0) << "\t" << percentile(row.ms, 99.0) << "\t"
+                  << row.ms.back() << "\t" << row.wrong << std::endl;
+    };
+    print_row("직접", direct);
+    print_row("풀(예열)", warm);
+    print_row("풀(지속)", sustained);
+    std::cout << "p50 감소: " << percentile(direct.ms, 50.0) - percentile(warm.ms, 50.0) << " ms ("
+              << std::setprecision(1) << percentile(direct.ms, 50.0) / percentile(warm.ms, 50.0) << "x)" << std::endl;
+
+    std::cout << std::setprecision(2);
+    std::cout << "\n=== 풀(지속): 용량 " << pool_config.capacity << ", 보충 스레드 " << pool_config.refill_threads
+              << ", low watermark " << pool_config.low_watermark << ", " << rate << " 요청/초 ===" << std::endl;
+    std::cout << "생성 " << sustained_stats.produced << ", 사용 " << sustained_stats.taken << ", 바로 암호화(빈 풀) "
+              << sustained_stats.misses << ", 알람 " << sustained_stats.alarms << ", 최소 남은 개수 "
+              << sustained_stats.min_remaining << std::endl;
+    std::cout << "Enc(0) 생성 평균: "
+              << (sustained_stats.produced ? sustained_stats.produce_ms / sustained_stats.produced : 0.0)
+              << " ms (보충 스레드 하나의 최대 공급 " << std::setprecision(1)
+              << (sustained_stats.produce_ms > 0.0 ? sustained_stats.produced * 1000.0 / sustained_stats.produce_ms : 0.0)
+              << " 개/초)" << std::endl;
+
+    return (direct.wrong + warm.wrong + sustained.wrong) == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include "he_angle_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "he_backend.h"
+
+namespace {
+
+double sin_function(double x) {
+    return std::sin(x);
+}
+
+double cos_function(double x) {
+    return std::cos(x);
+}
+
+}  // namespace
+
+uint32_t angle_tracker_depth(const AngleTrackerConfig& config) {
+    // 체비쇼프 결과 레벨에서 갱신마다 max(상태, 스텝) + 1
+    const uint32_t base = std::max(chebyshev_depth(config.full_degree), kAngleStepDepth);
+    return base + static_cast<uint32_t>(config.refresh_interval);
+}
+
+HeContext make_angle_tracker_context(const AngleTrackerConfig& config) {
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(angle_tracker_depth(config));
+    parameters.SetScalingModSize(config.scaling_mod_size);
+    parameters.SetFirstModSize(config.first_mod_size);
+    parameters.SetSecurityLevel(config.security);
+    parameters.SetBatchSize(config.slots);
+    if (config.security == SecurityLevel::HEStd_NotSet) parameters.SetRingDim(config.ring_dim);
+    return load_or_create_context(parameters);
+}
+
+uint32_t levels_used(const ConstCiphertext<DCRTPoly>& ct) {
+    return static_cast<uint32_t>(ct->GetLevel() + ct->GetNoiseScaleDeg() - 1);
+}
+
+AngleTracker::AngleTracker(CryptoContext<DCRTPoly> cc, AngleTrackerConfig config)
+    : m_cc(std::move(cc)), m_config(config), m_depth(angle_tracker_depth(m_config)) {}
+
+void AngleTracker::refresh(const Ciphertext<DCRTPoly>& ct_x) {
+    const double x_max = m_config.x_max;
+    m_sin = m_cc->EvalChebyshevFunction(sin_function, ct_x, -x_max, x_max, m_config.full_degree);
+    m_cos = m_cc->EvalChebyshevFunction(cos_function, ct_x, -x_max, x_max, m_config.full_degree);
+    m_since_refresh = 0;
+    m_stats.refreshes++;
+    m_stats.state_level = levels_used(m_sin);
+}
+
+uint32_t AngleTracker::step_level() const {
+    const uint32_t state = m_sin ? levels_used(m_sin) : 0;
+    return state > kAngleStepDepth ? state - kAngleStepDepth : 0;
+}
+
+void AngleTracker::update(const Ciphertext<DCRTPoly>& ct_step) {
+    // 맨 위 레벨로 들어온 스텝은 상태에 맞춰 타워를 먼저 버린다 (이후 곱이 적은 타워에서 돈다)
+    Ciphertext<DCRTPoly> d = ct_step;
+    const uint32_t level = step_level();
+    if (levels_used(d) < level) d = m_cc->LevelReduce(d, nullptr, level - levels_used(d));
+
+    // sin d ≈ d + d^2 * (-d / 6)              (스텝 레벨 + 2)
+    // cos d ≈ 1 + d^2 * (d^2 / 24 - 1 / 2)    (스텝 레벨 + 3 = 상태 레벨)
+    auto d2 = m_cc->EvalSquare(d);
+    auto sin_d = m_cc->EvalAdd(d, m_cc->EvalMult(d2, m_cc->EvalMult(d, -1.0 / 6.0)));
+    auto cos_d = m_cc->EvalAdd(m_cc->EvalMult(d2, m_cc->EvalAdd(m_cc->EvalMult(d2, 1.0 / 24.0), -0.5)), 1.0);
+
+    // 덧셈 정리: 곱 네 개는 재선형화 없이 두고 합계마다 한 번씩 재선형화
+    auto sin_next = m_cc->EvalAdd(m_cc->EvalMultNoRelin(m_sin, cos_d), m_cc->EvalMultNoRelin(m_cos, sin_d));
+    auto cos_next = m_cc->EvalSub(m_cc->EvalMultNoRelin(m_cos, cos_d), m_cc->EvalMultNoRelin(m_sin, sin_d));
+    m_sin = m_cc->Relinearize(sin_next);
+    m_cos = m_cc->Relinearize(cos_next);
+
+    m_since_refresh++;
+    m_stats.updates++;
+    m_stats.key_switches += 5;
+    m_stats.state_level = levels_used(m_sin);
+}
+
+bool AngleTracker::needs_refresh() const {
+    if (!m_sin || m_since_refresh >= m_config.refresh_interval) return true;
+    return std::max(levels_used(m_sin), kAngleStepDepth) + 1 > m_depth;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "he_context_cache.h"
+
+// ====== 증분 각도 추적 (CKKS) ======
+// talyor.m 처럼 각도가 작은 스텝의 누적합 x(k) = x(k-1) + d(k) 이면, 암호문 상태 (sin x, cos x) 를 두고
+// 샘플마다 스텝의 저차 근사 sin d ≈ d - d^3/6, cos d ≈ 1 - d^2/2 + d^4/24 만 평가해 덧셈 정리로 옮긴다.
+//   sin(x + d) = sin x cos d + cos x sin d,   cos(x + d) = cos x cos d - sin x sin d
+// 갱신마다 상태가 레벨 1 을 쓰고 스텝 근사 오차가 쌓이므로, refresh_interval 번 갱신하면 (또는 레벨이 모자라면)
+// 절대각 암호문에서 체비쇼프 근사로 (sin x, cos x) 를 다시 만든다. refresh_interval = 0 이면 매 샘플 전체 평가.
+// BGV 정수 스케일은 곱할 때마다 출력 스케일이 곱해지고 줄일 방법이 없어, 재스케일이 되는 CKKS 를 쓴다.
+
+struct AngleTrackerConfig {
+    size_t full_degree = 13;       // 다시 만들 때 쓰는 체비쇼프 차수
+    double x_max = 2.5;            // 체비쇼프 근사 범위 [-x_max, x_max] (랜덤워크는 ±pi/2 를 조금 넘는다)
+    size_t refresh_interval = 8;   // 다시 만든 뒤 증분 갱신 횟수
+    SecurityLevel security = SecurityLevel::HEStd_NotSet;
+    uint32_t ring_dim = 16384;     // HEStd_NotSet 일 때만 사용
+    uint32_t slots = 16;           // 슬롯 0 만 사용
+    uint32_t scaling_mod_size = 50;
+    uint32_t first_mod_size = 60;
+};
+
+// 스텝 근사가 쓰는 뎁스 (cos d 의 d^2 * (d^2/24 - 1/2))
+constexpr uint32_t kAngleStepDepth = 3;
+
+// 체비쇼프 재생성 뒤 refresh_interval 번 갱신할 수 있는 곱셈 뎁스
+uint32_t angle_tracker_depth(const AngleTrackerConfig& config);
+
+// 위 뎁스의 CKKS 컨텍스트 (디스크 캐시 사용)
+HeContext make_angle_tracker_context(const AngleTrackerConfig& config);
+
+// 암호문이 쓴 레벨 (FLEXIBLEAUTO 에서 아직 재스케일하지 않은 곱 포함)
+uint32_t levels_used(const ConstCiphertext<DCRTPoly>& ct);
+
+struct AngleTrackerStats {
+    size_t updates = 0;            // 증분 갱신 수
+    size_t refreshes = 0;          // 절대각에서 다시 만든 수
+    size_t key_switches = 0;       // 증분 갱신에 쓴 재선형화 수 (갱신당 5)
+    uint32_t state_level = 0;      // 현재 상태 암호문이 쓴 레벨
+};
+
+class AngleTracker {
+public:
+    AngleTracker(CryptoContext<DCRTPoly> cc, AngleTrackerConfig config);
+
+    // 절대각 암호문에서 (sin x, cos x) 를 체비쇼프 근사로 다시 만든다
+    void refresh(const Ciphertext<DCRTPoly>& ct_x);
+
+    // 스텝을 암호화할 레벨: 스텝 근사 (뎁스 3) 가 끝나는 레벨이 상태 레벨과 맞도록 상태 레벨 - 3 (최소 0).
+    // 맨 위 레벨로 암호화하면 스텝 근사가 전체 타워 (뎁스 max(체비쇼프, 3) + 주기) 에서 돈다
+    uint32_t step_level() const;
+
+    // 스텝 암호문 d 로 상태를 x + d 로 옮긴다 (step_level() 보다 위 레벨이면 먼저 그 레벨로 내린다)
+    void update(const Ciphertext<DCRTPoly>& ct_step);
+
+    // 다음 샘플에 스텝 대신 절대각이 필요한지 (상태 없음 / 주기 도달 / 남은 레벨 부족)
+    bool needs_refresh() const;
+
+    const Ciphertext<DCRTPoly>& sin_state() const { return m_sin; }
+    const Ciphertext<DCRTPoly>& cos_state() const { return m_cos; }
+    const AngleTrackerStats& stats() const { return m_stats; }
+
+private:
+    CryptoContext<DCRTPoly> m_cc;
+    AngleTrackerConfig m_config;
+    uint32_t m_depth;
+    Ciphertext<DCRTPoly> m_sin;
+    Ciphertext<DCRTPoly> m_cos;
+    size_t m_since_refresh = 0;
+    AngleTrackerStats m_stats;
+};
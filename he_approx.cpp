@@ -0,0 +1,204 @@
+#include "he_approx.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using Real = long double;
+
+// 부분 피벗 가우스 소거
+std::vector<Real> solve_linear(std::vector<std::vector<Real>> a, std::vector<Real> b) {
+    const size_t n = b.size();
+    for (size_t c = 0; c < n; c++) {
+        size_t pivot = c;
+        for (size_t r = c + 1; r < n; r++) {
+            if (std::abs(a[r][c]) > std::abs(a[pivot][c])) pivot = r;
+        }
+        std::swap(a[c], a[pivot]);
+        std::swap(b[c], b[pivot]);
+        for (size_t r = 0; r < n; r++) {
+            if (r == c) continue;
+            Real factor = a[r][c] / a[c][c];
+            for (size_t k = c; k < n; k++) a[r][k] -= factor * a[c][k];
+            b[r] -= factor * b[c];
+        }
+    }
+    for (size_t i = 0; i < n; i++) b[i] /= a[i][i];
+    return b;
+}
+
+Real eval_odd(const std::vector<Real>& odd, Real x) {
+    Real x2 = x * x;
+    Real acc = 0.0L;
+    for (size_t j = odd.size(); j-- > 0;) acc = acc * x2 + odd[j];
+    return acc * x;
+}
+
+Real eval_odd(const std::vector<double>& odd, Real x) {
+    return eval_odd(std::vector<Real>(odd.begin(), odd.end()), x);
+}
+
+// 점 x_i 에서 홀수 기저 값을 정확히 맞추는 계수 (교대 오차 항 E 를 포함하면 Remez 한 단계)
+std::vector<Real> fit_points(const std::function<double(double)>& f, const std::vector<Real>& points, size_t terms,
+                             bool alternating_error) {
+    const size_t n = terms + (alternating_error ? 1 : 0);
+    std::vector<std::vector<Real>> a(n, std::vector<Real>(n, 0.0L));
+    std::vector<Real> b(n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < terms; j++) a[i][j] = std::pow(points[i], static_cast<Real>(2 * j + 1));
+        if (alternating_error) a[i][terms] = (i % 2 == 0) ? 1.0L : -1.0L;
+        b[i] = f(static_cast<double>(points[i]));
+    }
+    auto solution = solve_linear(a, b);
+    solution.resize(terms);
+    return solution;
+}
+
+}  // namespace
+
+std::vector<double> taylor_sin_odd(size_t degree) {
+    std::vector<double> odd;
+    long double factorial = 1.0L;
+    for (size_t k = 1; k <= degree; k++) {
+        factorial *= k;
+        if (k % 2 == 1) odd.push_back(static_cast<double>(((k / 2) % 2 == 0 ? 1.0L : -1.0L) / factorial));
+    }
+    return odd;
+}
+
+std::vector<double> fit_odd_chebyshev(const std::function<double(double)>& f, size_t degree, double x_max) {
+    const size_t terms = (degree + 1) / 2;
+    std::vector<Real> nodes(terms);
+    for (size_t i = 0; i < terms; i++) {
+        nodes[i] = x_max * std::cos((2.0L * i + 1.0L) * M_PI / (2.0L * (degree + 1)));
+    }
+    auto odd = fit_points(f, nodes, terms, false);
+    return std::vector<double>(odd.begin(), odd.end());
+}
+
+std::vector<double> fit_odd_minimax(const std::function<double(double)>& f, size_t degree, double x_max,
+                                    int iterations) {
+    const size_t terms = (degree + 1) / 2;
+    const size_t grid = 4000;
+
+    // 기준점 terms + 1 개 (0 은 홀함수에서 오차가 항상 0 이라 제외)
+    std::vector<Real> reference(terms + 1);
+    for (size_t i = 0; i <= terms; i++) {
+        reference[i] = x_max * std::sin(M_PI / 2.0L * (i + 1) / (terms + 1));
+    }
+
+    std::vector<Real> odd;
+    for (int it = 0; it < iterations; it++) {
+        odd = fit_points(f, reference, terms, true);
+
+        // 오차 부호가 같은 구간마다 |오차| 최대점을 새 기준점 후보로
+        std::vector<Real> xs(grid), errors(grid);
+        for (size_t g = 0; g < grid; g++) {
+            xs[g] = x_max * (g + 1.0L) / grid;
+            errors[g] = f(static_cast<double>(xs[g])) - eval_odd(odd, xs[g]);
+        }
+        std::vector<size_t> extrema;
+        size_t start = 0;
+        for (size_t g = 1; g <= grid; g++) {
+            if (g == grid || (errors[g] > 0) != (errors[start] > 0)) {
+                size_t best = start;
+                for (size_t k = start; k < g; k++) {
+                    if (std::abs(errors[k]) > std::abs(errors[best])) best = k;
+                }
+                extrema.push_back(best);
+                start = g;
+            }
+        }
+        while (extrema.size() > terms + 1) {
+            if (std::abs(errors[extrema.front()]) < std::abs(errors[extrema.back()])) {
+                extrema.erase(extrema.begin());
+            } else {
+                extrema.pop_back();
+            }
+        }
+        if (extrema.size() < terms + 1) break;
+        for (size_t i = 0; i <= terms; i++) reference[i] = xs[extrema[i]];
+    }
+    return std::vector<double>(odd.begin(), odd.end());
+}
+
+double odd_poly_error(const std::function<double(double)>& f, const std::vector<double>& odd, double x_max) {
+    const size_t grid = 100000;
+    double max_error = 0.0;
+    for (size_t g = 0; g <= grid; g++) {
+        Real x = x_max * static_cast<Real>(g) / grid;
+        max_error = std::max(max_error, static_cast<double>(std::abs(f(static_cast<double>(x)) - eval_odd(odd, x))));
+    }
+    return max_error;
+}
+
+ScaledPolynomial quantize_odd(const std::vector<double>& odd, int64_t s, double scale) {
+    ScaledPolynomial poly;
+    poly.coeffs.assign(2 * odd.size(), 0);
+    poly.s = s;
+    poly.scale = scale;
+    for (size_t j = 0; j < odd.size(); j++) {
+        const size_t k = 2 * j + 1;
+        poly.coeffs[k] = static_cast<int64_t>(std::llround(odd[j] * scale / std::pow(static_cast<Real>(s), k)));
+    }
+    return poly;
+}
+
+IntegerPlan best_quantization(const std::vector<double>& odd, double x_max, int64_t t) {
+    const size_t degree = 2 * odd.size() - 1;
+    const double half_t = static_cast<double>(t / 2);
+
+    // 실수 다항식의 |p(x)| 최대값 (출력 스케일 상한 계산용)
+    double p_max = 0.0;
+    for (size_t g = 0; g <= 10000; g++) {
+        p_max = std::max(p_max, static_cast<double>(std::abs(eval_odd(odd, x_max * g / 10000.0L))));
+    }
+
+    IntegerPlan best;
+    best.max_error = INFINITY;
+    for (int64_t s = 2; s <= 4096; s += std::max<int64_t>(1, s / 32)) {
+        // 계수 반올림이 만들 수 있는 최대 편차만큼 여유를 두고 출력 스케일을 최대로
+        const double x_limit = std::llround(s * x_max);
+        double slack = 0.0;
+        for (size_t k = 1; k <= degree; k += 2) slack += 0.5 * std::pow(x_limit, static_cast<double>(k));
+        double scale = (half_t - 1.0 - slack) / p_max;
+        if (scale < std::pow(static_cast<double>(s), static_cast<double>(degree))) break;  // 최고차 계수가 0 으로 반올림됨
+
+        IntegerPlan plan = simulate_integer_pipeline(quantize_odd(odd, s, scale), 0, x_max);
+        while (plan.y_max >= t / 2) {
+            scale *= 0.999;
+            plan = simulate_integer_pipeline(quantize_odd(odd, s, scale), 0, x_max);
+        }
+        if (plan.max_error < best.max_error) best = plan;
+    }
+    return best;
+}
+
+double chebyshev_series_error(const std::function<double(double)>& f, double a, double b, size_t degree) {
+    // c_k = 2/(n+1) sum_j f(cos theta_j) cos(k theta_j),  p(y) = c_0/2 + sum_k c_k T_k(y)
+    const size_t nodes = degree + 1;
+    std::vector<Real> c(nodes, 0.0L);
+    for (size_t j = 0; j < nodes; j++) {
+        Real theta = M_PI * (j + 0.5L) / nodes;
+        Real fx = f(static_cast<double>((b - a) / 2.0L * std::cos(theta) + (a + b) / 2.0L));
+        for (size_t k = 0; k < nodes; k++) c[k] += 2.0L / nodes * fx * std::cos(k * theta);
+    }
+
+    const size_t grid = 100000;
+    double max_error = 0.0;
+    for (size_t g = 0; g <= grid; g++) {
+        Real x = a + (b - a) * static_cast<Real>(g) / grid;
+        Real y = (2.0L * x - a - b) / (b - a);
+        // Clenshaw
+        Real b1 = 0.0L, b2 = 0.0L;
+        for (size_t k = nodes; k-- > 1;) {
+            Real b0 = 2.0L * y * b1 - b2 + c[k];
+            b2 = b1;
+            b1 = b0;
+        }
+        Real p = y * b1 - b2 + c[0] / 2.0L;
+        max_error = std::max(max_error, static_cast<double>(std::abs(f(static_cast<double>(x)) - p)));
+    }
+    return max_error;
+}
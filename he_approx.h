@@ -0,0 +1,34 @@
+#pragma once
+
+#include "he_tune.h"
+
+#include <functional>
+
+// ====== 홀수 다항식 근사 (테일러 / 체비쇼프 / 미니맥스) ======
+// sin 은 홀함수이므로 x, x^3, ..., x^n 홀수 기저만 사용해 [0, x_max] 에서 맞추면 [-x_max, x_max] 전체에서 같은 오차를 갖는다.
+// 계수 벡터 odd[j] 는 x^(2j+1) 의 실수 계수.
+
+// sin 테일러 계수 (비교 기준)
+std::vector<double> taylor_sin_odd(size_t degree);
+
+// 체비쇼프 보간: T_{n+1} 의 양수 근 (n+1)/2 개에서 f 를 정확히 맞춘다
+std::vector<double> fit_odd_chebyshev(const std::function<double(double)>& f, size_t degree, double x_max);
+
+// Remez 교환 알고리즘으로 max |f - p| 를 최소화 (체비쇼프 교대점에서 시작)
+std::vector<double> fit_odd_minimax(const std::function<double(double)>& f, size_t degree, double x_max,
+                                    int iterations = 30);
+
+// 실수 계수 다항식의 max |f - p| (정수화 이전 근사 오차, 조밀한 격자로 계산)
+double odd_poly_error(const std::function<double(double)>& f, const std::vector<double>& odd, double x_max);
+
+// 출력 스케일 scale 로 정수화: ic_k = round(c_k * scale / s^k), y ≈ y_scaled / scale
+// (make_taylor_sin 은 scale = denom * s^n 인 특수한 경우)
+ScaledPolynomial quantize_odd(const std::vector<double>& odd, int64_t s, double scale);
+
+// 정확한 결과가 (-t/2, t/2) 안에 남는 범위에서 s 와 출력 스케일을 골라 |x| <= x_max 최대 오차를 최소화.
+// 입력 양자화(0.5/s)와 고차 계수 반올림((s x_max)^n / scale)이 서로 반대로 움직이므로 s 를 훑어 최적점을 찾는다.
+// 반환값의 denom 은 0 (출력 스케일이 denom * s^n 형태가 아님)
+IntegerPlan best_quantization(const std::vector<double>& odd, double x_max, int64_t t);
+
+// [a, b] 에서 차수 degree 체비쇼프 보간 급수(EvalChebyshevFunction 과 같은 degree + 1 개 노드)의 max |f - p|
+double chebyshev_series_error(const std::function<double(double)>& f, double a, double b, size_t degree);
@@ -0,0 +1,104 @@
+#include "he_backend.h"
+
+#include <cmath>
+
+#include "he_approx.h"
+
+namespace {
+
+double sin_function(double x) {
+    return std::sin(x);
+}
+
+}  // namespace
+
+uint32_t chebyshev_depth(size_t degree) {
+    // 차수 상한별 뎁스: <= 5 -> 4, <= 13 -> 5, <= 27 -> 6, ...
+    const size_t upper[] = {5, 13, 27, 59, 119, 247, 495, 1007, 2031};
+    uint32_t depth = 4;
+    for (size_t limit : upper) {
+        if (degree <= limit) return depth;
+        depth++;
+    }
+    return depth;
+}
+
+// ====== BGV ======
+BgvSinBackend::BgvSinBackend(const BackendConfig& config) {
+    const size_t degree = config.degree % 2 == 0 ? config.degree - 1 : config.degree;
+    auto plan = best_quantization(fit_odd_minimax(sin_function, degree, config.x_max), config.x_max,
+                                  config.plaintext_modulus);
+    m_poly = plan.poly;
+    m_max_error = plan.max_error;
+    m_depth = required_depth(m_poly.degree());
+
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(config.plaintext_modulus);
+    parameters.SetMultiplicativeDepth(m_depth);
+    parameters.SetSecurityLevel(config.security);
+    parameters.SetBatchSize(config.slots);
+    if (config.security == SecurityLevel::HEStd_NotSet) parameters.SetRingDim(config.ring_dim);
+
+    m_he = load_or_create_context(parameters);
+    m_evaluator = std::make_unique<PolyEvaluator>(m_he.cc);
+}
+
+Ciphertext<DCRTPoly> BgvSinBackend::encrypt(const std::vector<double>& x) {
+    std::vector<int64_t> x_scaled(x.size());
+    for (size_t i = 0; i < x.size(); i++) x_scaled[i] = static_cast<int64_t>(std::round(m_poly.s * x[i]));
+    return m_he.cc->Encrypt(m_he.keyPair.publicKey, m_he.cc->MakePackedPlaintext(x_scaled));
+}
+
+Ciphertext<DCRTPoly> BgvSinBackend::evaluate(const Ciphertext<DCRTPoly>& ct_x) {
+    return m_evaluator->evaluate(ct_x, m_poly);
+}
+
+std::vector<double> BgvSinBackend::decrypt(const Ciphertext<DCRTPoly>& ct_y, size_t count) {
+    const int64_t t = static_cast<int64_t>(m_he.cc->GetEncodingParams()->GetPlaintextModulus());
+    Plaintext p_y;
+    m_he.cc->Decrypt(m_he.keyPair.secretKey, ct_y, &p_y);
+    p_y->SetLength(count);
+    std::vector<double> y(count);
+    for (size_t i = 0; i < count; i++) {
+        y[i] = static_cast<double>(centered_mod(p_y->GetPackedValue()[i], t)) / m_poly.scale;
+    }
+    return y;
+}
+
+// ====== CKKS ======
+CkksSinBackend::CkksSinBackend(const BackendConfig& config) : m_degree(config.degree), m_x_max(config.x_max) {
+    m_max_error = chebyshev_series_error(sin_function, -m_x_max, m_x_max, m_degree);
+    m_depth = chebyshev_depth(m_degree);
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(m_depth);
+    parameters.SetScalingModSize(config.scaling_mod_size);
+    parameters.SetFirstModSize(config.first_mod_size);
+    parameters.SetSecurityLevel(config.security);
+    parameters.SetBatchSize(config.slots);
+    if (config.security == SecurityLevel::HEStd_NotSet) parameters.SetRingDim(config.ring_dim);
+
+    m_he = load_or_create_context(parameters);
+}
+
+Ciphertext<DCRTPoly> CkksSinBackend::encrypt(const std::vector<double>& x) {
+    return m_he.cc->Encrypt(m_he.keyPair.publicKey, m_he.cc->MakeCKKSPackedPlaintext(x));
+}
+
+Ciphertext<DCRTPoly> CkksSinBackend::evaluate(const Ciphertext<DCRTPoly>& ct_x) {
+    return m_he.cc->EvalChebyshevFunction(sin_function, ct_x, -m_x_max, m_x_max, m_degree);
+}
+
+std::vector<double> CkksSinBackend::decrypt(const Ciphertext<DCRTPoly>& ct_y, size_t count) {
+    Plaintext p_y;
+    m_he.cc->Decrypt(m_he.keyPair.secretKey, ct_y, &p_y);
+    p_y->SetLength(count);
+    auto values = p_y->GetRealPackedValue();
+    values.resize(count);
+    return values;
+}
+
+std::unique_ptr<SinBackend> make_sin_backend(const std::string& scheme, const BackendConfig& config) {
+    if (scheme == "ckks") return std::make_unique<CkksSinBackend>(config);
+    return std::make_unique<BgvSinBackend>(config);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+
+#include <memory>
+#include <string>
+
+// ====== sin 평가 백엔드 (BGV 정수 스케일 / CKKS 근사 연산) ======
+// 같은 인터페이스(실수 입력 암호화 -> sin 평가 -> 실수 결과 복호화)로 두 스킴을 나란히 비교한다.
+// - BGV : x_scaled = round(s * x), 미니맥스 홀수 다항식 정수화 (he_approx) + PolyEvaluator
+// - CKKS: 실수 슬롯 패킹 + OpenFHE EvalChebyshevFunction (스케일링은 CKKS 가 관리, 큰 평문 모듈러스 불필요)
+
+struct BackendConfig {
+    size_t degree = 5;
+    double x_max = M_PI;
+    SecurityLevel security = SecurityLevel::HEStd_NotSet;
+    uint32_t ring_dim = 16384;                 // HEStd_NotSet 일 때만 사용 (보안 수준을 지정하면 OpenFHE 가 선택)
+    uint32_t slots = 8192;                     // 두 스킴 모두 같은 배치 크기 사용
+    int64_t plaintext_modulus = 593779228673;  // BGV
+    uint32_t scaling_mod_size = 50;            // CKKS
+    uint32_t first_mod_size = 60;              // CKKS
+};
+
+class SinBackend {
+public:
+    virtual ~SinBackend() = default;
+
+    virtual std::string name() const = 0;
+    virtual Ciphertext<DCRTPoly> encrypt(const std::vector<double>& x) = 0;
+    virtual Ciphertext<DCRTPoly> evaluate(const Ciphertext<DCRTPoly>& ct_x) = 0;
+    virtual std::vector<double> decrypt(const Ciphertext<DCRTPoly>& ct_y, size_t count) = 0;
+
+    // 잡음을 제외한 근사 자체의 최대 오차 (BGV: 정수 파이프라인 모의, CKKS: 체비쇼프 근사)
+    virtual double model_error() const = 0;
+
+    const HeContext& context() const { return m_he; }
+    uint32_t depth() const { return m_depth; }
+    uint32_t ring_dim() const { return m_he.cc->GetRingDimension(); }
+    size_t slots() const { return slot_count(m_he.cc); }
+
+protected:
+    HeContext m_he;
+    uint32_t m_depth = 0;
+};
+
+class BgvSinBackend : public SinBackend {
+public:
+    explicit BgvSinBackend(const BackendConfig& config);
+
+    std::string name() const override { return "BGV"; }
+    Ciphertext<DCRTPoly> encrypt(const std::vector<double>& x) override;
+    Ciphertext<DCRTPoly> evaluate(const Ciphertext<DCRTPoly>& ct_x) override;
+    std::vector<double> decrypt(const Ciphertext<DCRTPoly>& ct_y, size_t count) override;
+    double model_error() const override { return m_max_error; }
+
+    const ScaledPolynomial& polynomial() const { return m_poly; }
+
+private:
+    ScaledPolynomial m_poly;
+    double m_max_error = 0.0;
+    std::unique_ptr<PolyEvaluator> m_evaluator;
+};
+
+class CkksSinBackend : public SinBackend {
+public:
+    explicit CkksSinBackend(const BackendConfig& config);
+
+    std::string name() const override { return "CKKS"; }
+    Ciphertext<DCRTPoly> encrypt(const std::vector<double>& x) override;
+    Ciphertext<DCRTPoly> evaluate(const Ciphertext<DCRTPoly>& ct_x) override;
+    std::vector<double> decrypt(const Ciphertext<DCRTPoly>& ct_y, size_t count) override;
+    double model_error() const override { return m_max_error; }
+
+private:
+    size_t m_degree;
+    double m_x_max;
+    double m_max_error = 0.0;
+};
+
+// "bgv" 또는 "ckks"
+std::unique_ptr<SinBackend> make_sin_backend(const std::string& scheme, const BackendConfig& config);
+
+// EvalChebyshevFunction 이 차수 degree 에서 소모하는 곱셈 뎁스 (OpenFHE FUNCTION_EVALUATION 표)
+uint32_t chebyshev_depth(size_t degree);
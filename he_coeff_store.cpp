@@ -0,0 +1,62 @@
+#include "he_coeff_store.h"
+
+CoeffStore::CoeffStore(CryptoContext<DCRTPoly> cc)
+    : m_cc(std::move(cc)),
+      m_t(static_cast<int64_t>(m_cc->GetEncodingParams()->GetPlaintextModulus())) {}
+
+uint32_t CoeffStore::target_level(const ConstCiphertext<DCRTPoly>& ct) {
+    return static_cast<uint32_t>(ct->GetLevel() + (ct->GetNoiseScaleDeg() > 1 ? 1 : 0));
+}
+
+ConstPlaintext CoeffStore::scalar(int64_t value, const ConstCiphertext<DCRTPoly>& ct) {
+    const auto key = std::make_pair(centered_mod(value, m_t), target_level(ct));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_scalars.find(key);
+    if (it != m_scalars.end()) {
+        m_hits++;
+        return it->second;
+    }
+
+    auto start = Clock::now();
+    auto p_coeff = m_cc->MakeCoefPackedPlaintext({key.first}, 1, key.second);
+    p_coeff->SetFormat(Format::EVALUATION);
+    m_encode_ms += elapsed_ms(start, Clock::now());
+    m_misses++;
+    return m_scalars.emplace(key, p_coeff).first->second;
+}
+
+ConstPlaintext CoeffStore::packed(const std::vector<int64_t>& values, const ConstCiphertext<DCRTPoly>& ct) {
+    std::vector<int64_t> reduced(values.size());
+    for (size_t i = 0; i < values.size(); i++) reduced[i] = centered_mod(values[i], m_t);
+    auto key = std::make_pair(std::move(reduced), target_level(ct));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_packed.find(key);
+    if (it != m_packed.end()) {
+        m_hits++;
+        return it->second;
+    }
+
+    auto start = Clock::now();
+    auto p_coeff = m_cc->MakePackedPlaintext(key.first, 1, key.second);
+    p_coeff->SetFormat(Format::EVALUATION);
+    m_encode_ms += elapsed_ms(start, Clock::now());
+    m_misses++;
+    return m_packed.emplace(std::move(key), p_coeff).first->second;
+}
+
+size_t CoeffStore::hits() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hits;
+}
+
+size_t CoeffStore::misses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_misses;
+}
+
+double CoeffStore::encode_ms() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_encode_ms;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "he_common.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+// ====== 계수 평문 캐시 ======
+// 다항식 계수처럼 바뀌지 않는 상수를 컨텍스트당 한 번만 인코딩하고,
+// 사용되는 레벨마다 평가(NTT) 형태로 보관해 평가기에 공유 핸들(ConstPlaintext)로 넘겨준다.
+// 여러 스레드에서 동시에 사용해도 안전하다.
+class CoeffStore {
+public:
+    explicit CoeffStore(CryptoContext<DCRTPoly> cc);
+
+    // 모든 슬롯에 같은 값을 곱하는 계수: 상수 다항식 value (coef-packed) 로 인코딩.
+    // 상수 다항식은 모든 슬롯에서 value 로 평가되므로 packed 암호문에 그대로 곱하거나 더할 수 있고,
+    // 슬롯 -> 계수 역변환이 필요 없어 브로드캐스트 벡터보다 인코딩이 싸다.
+    // coef-packed 인코딩은 (-t/2, t/2] 밖의 값을 거부하므로 음수 계수는 centered 값으로 둔다.
+    ConstPlaintext scalar(int64_t value, const ConstCiphertext<DCRTPoly>& ct);
+
+    // 슬롯마다 다른 계수 (packed encoding)
+    ConstPlaintext packed(const std::vector<int64_t>& values, const ConstCiphertext<DCRTPoly>& ct);
+
+    size_t hits() const;
+    size_t misses() const;
+    double encode_ms() const;
+
+private:
+    // ct 에 곱해질 때 사용될 레벨 (FLEXIBLEAUTO 에서는 noise scale degree 2 인 암호문이 곱셈 전에 mod reduce 됨)
+    static uint32_t target_level(const ConstCiphertext<DCRTPoly>& ct);
+
+    CryptoContext<DCRTPoly> m_cc;
+    int64_t m_t;
+
+    mutable std::mutex m_mutex;
+    std::map<std::pair<int64_t, uint32_t>, Plaintext> m_scalars;
+    std::map<std::pair<std::vector<int64_t>, uint32_t>, Plaintext> m_packed;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+    double m_encode_ms = 0.0;
+};
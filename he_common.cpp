@@ -0,0 +1,64 @@
+#include "he_common.h"
+
+#include <openfhe/pke/ciphertext-ser.h>
+#include <openfhe/pke/scheme/bgvrns/bgvrns-ser.h>
+#include <openfhe/pke/scheme/ckksrns/ckksrns-ser.h>
+
+#include <algorithm>
+#include <sstream>
+
+size_t slot_count(const CryptoContext<DCRTPoly>& cc) {
+    // batch size 를 따로 지정하지 않으면 링 차원 전체가 슬롯으로 쓰인다
+    size_t batch = cc->GetEncodingParams()->GetBatchSize();
+    return batch > 0 ? batch : cc->GetRingDimension();
+}
+
+Plaintext make_broadcast_plaintext(const CryptoContext<DCRTPoly>& cc, int64_t value) {
+    return cc->MakePackedPlaintext(std::vector<int64_t>(slot_count(cc), value));
+}
+
+std::vector<Ciphertext<DCRTPoly>> encrypt_batch(const CryptoContext<DCRTPoly>& cc,
+                                                const PublicKey<DCRTPoly>& publicKey,
+                                                const std::vector<int64_t>& values) {
+    const size_t slots = slot_count(cc);
+    std::vector<Ciphertext<DCRTPoly>> ciphertexts;
+    ciphertexts.reserve((values.size() + slots - 1) / slots);
+
+    for (size_t offset = 0; offset < values.size(); offset += slots) {
+        size_t end = std::min(values.size(), offset + slots);
+        std::vector<int64_t> chunk(values.begin() + offset, values.begin() + end);
+        auto p_chunk = cc->MakePackedPlaintext(chunk);
+        ciphertexts.push_back(cc->Encrypt(publicKey, p_chunk));
+    }
+    return ciphertexts;
+}
+
+std::vector<int64_t> decrypt_batch(const CryptoContext<DCRTPoly>& cc,
+                                   const PrivateKey<DCRTPoly>& secretKey,
+                                   const std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                                   size_t count) {
+    const size_t slots = slot_count(cc);
+    const int64_t t = static_cast<int64_t>(cc->GetEncodingParams()->GetPlaintextModulus());
+    std::vector<int64_t> values;
+    values.reserve(count);
+
+    for (const auto& ct : ciphertexts) {
+        if (values.size() >= count) break;
+        size_t n = std::min(slots, count - values.size());
+
+        Plaintext p_chunk;
+        cc->Decrypt(secretKey, ct, &p_chunk);
+        p_chunk->SetLength(n);
+        const auto& packed = p_chunk->GetPackedValue();
+        for (size_t i = 0; i < n; i++) {
+            values.push_back(centered_mod(packed[i], t));
+        }
+    }
+    return values;
+}
+
+size_t ciphertext_bytes(const Ciphertext<DCRTPoly>& ct) {
+    std::ostringstream os;
+    Serial::Serialize(ct, os, SerType::BINARY);
+    return os.str().size();
+}
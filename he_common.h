@@ -0,0 +1,35 @@
+#pragma once
+
+#include <openfhe/pke/openfhe.h>
+#include <cstdint>
+#include <vector>
+
+#include "he_util.h"
+
+using namespace lbcrypto;
+
+// ====== 공통 유틸리티 ======
+// 암호문을 다루는 실행파일들이 공유하는 헬퍼. 시간 측정, centered mod 보정, 명령행 인자는 he_util.h (OpenFHE 불필요)
+
+// ====== 슬롯 패킹 (배치 모드) ======
+
+// 하나의 암호문에 담을 수 있는 슬롯 수 (BGV packed encoding 기준)
+size_t slot_count(const CryptoContext<DCRTPoly>& cc);
+
+// 모든 슬롯에 같은 값을 채운 평문 (배치 모드용 계수 평문)
+Plaintext make_broadcast_plaintext(const CryptoContext<DCRTPoly>& cc, int64_t value);
+
+// values 를 slot_count 단위로 잘라 암호문 여러 개로 암호화
+std::vector<Ciphertext<DCRTPoly>> encrypt_batch(const CryptoContext<DCRTPoly>& cc,
+                                                const PublicKey<DCRTPoly>& publicKey,
+                                                const std::vector<int64_t>& values);
+
+// encrypt_batch 의 역과정: 암호문들을 복호화해 앞에서부터 count 개의 값을 centered 형태로 반환
+std::vector<int64_t> decrypt_batch(const CryptoContext<DCRTPoly>& cc,
+                                   const PrivateKey<DCRTPoly>& secretKey,
+                                   const std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                                   size_t count);
+
+// ====== 직렬화 ======
+// 직렬화한 암호문 크기 (bytes, BGV / CKKS)
+size_t ciphertext_bytes(const Ciphertext<DCRTPoly>& ct);
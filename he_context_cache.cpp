@@ -0,0 +1,193 @@
+#include "he_context_cache.h"
+
+#include <openfhe/pke/cryptocontext-ser.h>
+#include <openfhe/pke/key/key-ser.h>
+#include <openfhe/pke/scheme/bgvrns/bgvrns-ser.h>
+#include <openfhe/pke/scheme/ckksrns/ckksrns-ser.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "he_wire.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// 읽기 전용 mmap 파일
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                m_data = static_cast<char*>(addr);
+                m_size = static_cast<size_t>(st.st_size);
+            }
+        }
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if (m_data) ::munmap(m_data, m_size);
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool ok() const { return m_data != nullptr; }
+    char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+template <typename Fn>
+bool read_mapped(const std::string& path, Fn&& fn) {
+    MappedFile file(path);
+    if (!file.ok()) return false;
+    MemoryStreamBuf buf(file.data(), file.size());
+    std::istream is(&buf);
+    return fn(is);
+}
+
+template <typename Fn>
+void write_file(const std::string& path, Fn&& fn) {
+    std::ofstream os(path, std::ios::binary);
+    if (!os) throw std::runtime_error("캐시 파일 생성 실패: " + path);
+    fn(os);
+}
+
+uint64_t fnv1a64(const std::string& text) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+}  // namespace
+
+std::string context_cache_root() {
+    const char* env = std::getenv("ENC_SIN_CACHE_DIR");
+    return env ? std::string(env) : std::string("he_cache");
+}
+
+std::string context_cache_dir(const std::string& root, const std::string& description) {
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fnv1a64(description)));
+    return (fs::path(root) / name).string();
+}
+
+bool load_public_context(const std::string& dir, HeContext& ctx) {
+    if (!fs::exists(fs::path(dir) / "cc.bin")) return false;
+    try {
+        bool ok = read_mapped(dir + "/cc.bin", [&](std::istream& is) {
+            Serial::Deserialize(ctx.cc, is, SerType::BINARY);
+            return ctx.cc != nullptr;
+        });
+        ok = ok && read_mapped(dir + "/pk.bin", [&](std::istream& is) {
+            Serial::Deserialize(ctx.keyPair.publicKey, is, SerType::BINARY);
+            return ctx.keyPair.publicKey != nullptr;
+        });
+        ok = ok && read_mapped(dir + "/evalmult.bin", [&](std::istream& is) {
+            return CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKey(is, SerType::BINARY);
+        });
+        if (ok && fs::exists(fs::path(dir) / "evalrot.bin")) {
+            ok = read_mapped(dir + "/evalrot.bin", [&](std::istream& is) {
+                return CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKey(is, SerType::BINARY);
+            });
+        }
+        if (!ok) return false;
+
+        ctx.cc->Enable(PKE);
+        ctx.cc->Enable(KEYSWITCH);
+        ctx.cc->Enable(LEVELEDSHE);
+        ctx.cc->Enable(ADVANCEDSHE);
+
+        std::ifstream meta(dir + "/meta.txt");
+        meta >> ctx.generate_ms >> ctx.context_ms >> ctx.keygen_ms;
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "캐시 로드 실패 (" << dir << "): " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool export_public_context(const std::string& dir, const std::string& out_dir) {
+    std::error_code ec;
+    fs::create_directories(out_dir, ec);
+    if (ec) return false;
+    for (const char* name : {"cc.bin", "pk.bin", "evalmult.bin", "evalrot.bin", "meta.txt"}) {
+        const fs::path from = fs::path(dir) / name;
+        if (!fs::exists(from)) {
+            if (std::string(name) == "evalrot.bin" || std::string(name) == "meta.txt") continue;
+            return false;
+        }
+        fs::copy_file(from, fs::path(out_dir) / name, fs::copy_options::overwrite_existing, ec);
+        if (ec) return false;
+    }
+    return !fs::exists(fs::path(out_dir) / "sk.bin");
+}
+
+bool load_cached_context(const std::string& dir, HeContext& ctx) {
+    if (!load_public_context(dir, ctx)) return false;
+    try {
+        return read_mapped(dir + "/sk.bin", [&](std::istream& is) {
+            Serial::Deserialize(ctx.keyPair.secretKey, is, SerType::BINARY);
+            return ctx.keyPair.secretKey != nullptr;
+        });
+    } catch (const std::exception& e) {
+        std::cerr << "캐시 로드 실패 (" << dir << "): " << e.what() << ", 새로 생성합니다" << std::endl;
+        return false;
+    }
+}
+
+void store_cached_context(const std::string& dir, const HeContext& ctx, bool has_rotation_keys) {
+    // 비밀키가 들어가므로 소유자만 접근 가능하게 만든 임시 디렉토리에 쓴 뒤 rename
+    const std::string tmp = dir + ".tmp." + std::to_string(::getpid());
+    try {
+        fs::create_directories(tmp);
+        fs::permissions(tmp, fs::perms::owner_all, fs::perm_options::replace);
+
+        write_file(tmp + "/cc.bin", [&](std::ostream& os) { Serial::Serialize(ctx.cc, os, SerType::BINARY); });
+        write_file(tmp + "/pk.bin", [&](std::ostream& os) { Serial::Serialize(ctx.keyPair.publicKey, os, SerType::BINARY); });
+        write_file(tmp + "/sk.bin", [&](std::ostream& os) { Serial::Serialize(ctx.keyPair.secretKey, os, SerType::BINARY); });
+        write_file(tmp + "/evalmult.bin", [&](std::ostream& os) {
+            CryptoContextImpl<DCRTPoly>::SerializeEvalMultKey(os, SerType::BINARY, ctx.keyPair.secretKey->GetKeyTag());
+        });
+        if (has_rotation_keys) {
+            write_file(tmp + "/evalrot.bin", [&](std::ostream& os) {
+                CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKey(os, SerType::BINARY, ctx.keyPair.secretKey->GetKeyTag());
+            });
+        }
+        write_file(tmp + "/meta.txt", [&](std::ostream& os) {
+            os << ctx.generate_ms << " " << ctx.context_ms << " " << ctx.keygen_ms << "\n";
+        });
+
+        // 로드에 실패한 (깨졌거나 형식이 다른) 기존 디렉토리는 옆으로 옮긴 뒤 교체한다.
+        // 그대로 두면 rename 이 매번 실패해 이후 실행도 계속 새로 생성하게 된다
+        std::error_code ec;
+        const std::string stale = dir + ".stale." + std::to_string(::getpid());
+        if (fs::exists(dir)) fs::rename(dir, stale, ec);
+        fs::rename(tmp, dir, ec);
+        if (ec) fs::remove_all(tmp, ec);  // 다른 프로세스가 그 사이에 만든 경우
+        fs::remove_all(stale, ec);
+    } catch (const std::exception& e) {
+        std::cerr << "캐시 저장 실패 (" << dir << "): " << e.what() << std::endl;
+        std::error_code ec;
+        fs::remove_all(tmp, ec);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "he_common.h"
+
+#include <sstream>
+#include <string>
+
+// ====== CryptoContext / 키 디스크 캐시 ======
+// 컨텍스트 생성 + KeyGen + EvalMultKeyGen 결과를 직렬화해 두고, 같은 CCParams 로 다시 실행하면
+// 재생성 대신 파일을 mmap 으로 읽어 역직렬화한다.
+// 캐시 위치: 환경변수 ENC_SIN_CACHE_DIR (기본 ./he_cache, 빈 문자열이면 캐시 사용 안 함)
+// 디렉토리 이름: CCParams 전체 출력 + 회전 인덱스의 64비트 FNV-1a 해시
+
+struct HeContext {
+    CryptoContext<DCRTPoly> cc;
+    KeyPair<DCRTPoly> keyPair;
+    bool from_cache = false;
+    double setup_ms = 0.0;      // 이번 실행의 컨텍스트 준비 시간 (생성 또는 로드)
+    double generate_ms = 0.0;   // 캐시를 처음 만들 때 기록한 생성 시간 (cold)
+    double context_ms = 0.0;    // 그중 GenCryptoContext + Enable
+    double keygen_ms = 0.0;     // 그중 KeyGen + EvalMultKeyGen (+ EvalRotateKeyGen)
+};
+
+// 캐시 루트 디렉토리 (빈 문자열이면 비활성)
+std::string context_cache_root();
+
+// 파라미터 설명 문자열에 대응하는 캐시 디렉토리 경로
+std::string context_cache_dir(const std::string& root, const std::string& description);
+
+// CCParams (+ 회전 인덱스) 에 대응하는 캐시 디렉토리 (캐시 비활성이면 빈 문자열)
+template <typename Scheme>
+std::string context_cache_dir_for(const CCParams<Scheme>& parameters, const std::vector<int32_t>& rotations = {}) {
+    std::ostringstream description;
+    description << parameters;
+    for (int32_t r : rotations) description << " rot" << r;
+
+    const std::string root = context_cache_root();
+    return root.empty() ? std::string() : context_cache_dir(root, description.str());
+}
+
+// dir 에서 컨텍스트, 공개키, eval 키만 로드 (비밀키는 읽지 않음, keyPair.secretKey == nullptr).
+// 평가 서버처럼 비밀키를 가지면 안 되는 쪽에서 사용
+bool load_public_context(const std::string& dir, HeContext& ctx);
+
+// dir 의 컨텍스트, 공개키, eval 키 파일만 out_dir 로 복사 (sk.bin 은 복사하지 않음).
+// 평가 서버에 넘겨줄 디렉토리를 만든다. 실패하면 false
+bool export_public_context(const std::string& dir, const std::string& out_dir);
+
+// dir 에서 컨텍스트, 공개키/비밀키, eval 키를 로드 (없거나 실패하면 false)
+bool load_cached_context(const std::string& dir, HeContext& ctx);
+
+// 컨텍스트와 키를 dir 에 저장 (임시 디렉토리에 쓴 뒤 rename, 로드에 실패한 기존 dir 은 교체)
+void store_cached_context(const std::string& dir, const HeContext& ctx, bool has_rotation_keys);
+
+template <typename Scheme>
+HeContext load_or_create_context(const CCParams<Scheme>& parameters, const std::vector<int32_t>& rotations = {}) {
+    const std::string dir = context_cache_dir_for(parameters, rotations);
+
+    HeContext ctx;
+    auto start = Clock::now();
+    if (!dir.empty() && load_cached_context(dir, ctx)) {
+        ctx.from_cache = true;
+    } else {
+        ctx.cc = GenCryptoContext(parameters);
+        ctx.cc->Enable(PKE);
+        ctx.cc->Enable(KEYSWITCH);
+        ctx.cc->Enable(LEVELEDSHE);
+        ctx.cc->Enable(ADVANCEDSHE);
+        auto end_context = Clock::now();
+
+        ctx.keyPair = ctx.cc->KeyGen();
+        ctx.cc->EvalMultKeyGen(ctx.keyPair.secretKey);
+        if (!rotations.empty()) ctx.cc->EvalRotateKeyGen(ctx.keyPair.secretKey, rotations);
+        auto end_keygen = Clock::now();
+        ctx.context_ms = elapsed_ms(start, end_context);
+        ctx.keygen_ms = elapsed_ms(end_context, end_keygen);
+        ctx.generate_ms = elapsed_ms(start, end_keygen);
+
+        if (!dir.empty()) store_cached_context(dir, ctx, !rotations.empty());
+    }
+    ctx.setup_ms = elapsed_ms(start, Clock::now());
+    return ctx;
+}
@@ -0,0 +1,174 @@
+#include "he_crt.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+#include <omp.h>
+
+#include "he_modmath.h"
+
+int128_t output_bound(const ScaledPolynomial& poly, int64_t x_limit) {
+    int128_t bound = 0;
+    for (int64_t x = -x_limit; x <= x_limit; x++) {
+        int128_t acc = 0;
+        for (size_t k = poly.coeffs.size(); k-- > 0;) {
+            acc = acc * x + poly.coeffs[k];
+        }
+        bound = std::max(bound, acc < 0 ? -acc : acc);
+    }
+    return bound;
+}
+
+int128_t crt_product(const std::vector<uint64_t>& moduli) {
+    int128_t product = 1;
+    for (uint64_t t : moduli) product *= t;
+    return product;
+}
+
+std::vector<uint64_t> choose_crt_moduli(int128_t y_bound, size_t count, uint32_t ring_dim) {
+    count = std::max<size_t>(1, count);
+    const int128_t needed = 2 * y_bound + 1;
+
+    // 모듈러스마다 대략 needed^(1/count) 부터 시작하고, 곱이 모자라면 시작점을 두 배씩 올린다
+    const double bits = std::log2(static_cast<double>(needed));
+    uint64_t start = static_cast<uint64_t>(std::ldexp(1.0, static_cast<int>(std::ceil(bits / count))));
+    while (true) {
+        std::vector<uint64_t> moduli;
+        uint64_t t = start;
+        for (size_t i = 0; i < count; i++) {
+            t = next_packing_prime(t, ring_dim);
+            moduli.push_back(t);
+            t++;
+        }
+        if (crt_product(moduli) > needed || moduli.back() >= (uint64_t(1) << 62)) return moduli;
+        start *= 2;
+    }
+}
+
+int128_t crt_combine(const std::vector<int64_t>& residues, const std::vector<uint64_t>& moduli) {
+    // Garner: y = v_0 + v_1 t_0 + v_2 t_0 t_1 + ...,  0 <= v_i < t_i
+    std::vector<uint64_t> v(moduli.size());
+    int128_t y = 0;
+    int128_t radix = 1;
+    for (size_t i = 0; i < moduli.size(); i++) {
+        const uint64_t t = moduli[i];
+        uint64_t partial = 0;   // v_0 + v_1 t_0 + ... (i 항까지) mod t
+        uint64_t prefix = 1;    // t_0 t_1 ... t_{i-1} mod t
+        for (size_t j = 0; j < i; j++) {
+            partial = (partial + mul_mod(v[j] % t, prefix, t)) % t;
+            prefix = mul_mod(prefix, moduli[j] % t, t);
+        }
+        const uint64_t r = static_cast<uint64_t>(positive_mod(residues[i], static_cast<int64_t>(t)));
+        const uint64_t diff = (r + t - partial) % t;
+        v[i] = mul_mod(diff, pow_mod(prefix, t - 2, t), t);
+        y += v[i] * radix;
+        radix *= t;
+    }
+    if (y > radix / 2) y -= radix;
+    return y;
+}
+
+CrtEvaluator::CrtEvaluator(const ScaledPolynomial& poly, const std::vector<uint64_t>& moduli, uint32_t ring_dim,
+                           CrtConfig config)
+    : m_poly(poly),
+      m_moduli(moduli),
+      m_ring_dim(ring_dim),
+      m_depth(required_depth(poly.degree())),
+      m_config(config) {
+    auto start = Clock::now();
+    m_channels.resize(m_moduli.size());
+    for (size_t i = 0; i < m_moduli.size(); i++) {
+        CCParams<CryptoContextBGVRNS> parameters;
+        parameters.SetPlaintextModulus(m_moduli[i]);
+        parameters.SetMultiplicativeDepth(m_depth);
+        parameters.SetSecurityLevel(m_config.security);
+        parameters.SetRingDim(m_ring_dim);
+
+        auto& channel = m_channels[i];
+        channel.t = m_moduli[i];
+        channel.he = load_or_create_context(parameters);
+        channel.evaluator = std::make_unique<PolyEvaluator>(channel.he.cc);
+        channel.towers = channel.he.cc->GetElementParams()->GetParams().size();
+    }
+    m_setup_ms = elapsed_ms(start, Clock::now());
+}
+
+void CrtEvaluator::run_channel(size_t index, const std::vector<int64_t>& x_scaled, ChannelRun& run) {
+    auto& channel = m_channels[index];
+    const auto& cc = channel.he.cc;
+
+    auto start = Clock::now();
+    auto cts = encrypt_batch(cc, channel.he.keyPair.publicKey, x_scaled);
+    auto end_encrypt = Clock::now();
+    for (auto& ct : cts) ct = channel.evaluator->evaluate(ct, m_poly);
+    auto end_eval = Clock::now();
+    run.residues = decrypt_batch(cc, channel.he.keyPair.secretKey, cts, x_scaled.size());
+    auto end = Clock::now();
+
+    run.encrypt_ms = elapsed_ms(start, end_encrypt);
+    run.eval_ms = elapsed_ms(end_encrypt, end_eval);
+    run.decrypt_ms = elapsed_ms(end_eval, end);
+}
+
+std::vector<int128_t> CrtEvaluator::evaluate(const std::vector<int64_t>& x_scaled, CrtTiming* timing) {
+    std::vector<ChannelRun> runs(m_channels.size());
+
+    auto start = Clock::now();
+    if (m_config.parallel && m_channels.size() > 1) {
+        // 채널마다 스레드 하나 (서로 다른 컨텍스트라 공유 상태 없음)
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < m_channels.size(); i++) {
+            workers.emplace_back([this, i, &x_scaled, &runs] {
+                omp_set_num_threads(m_config.openfhe_threads);
+                run_channel(i, x_scaled, runs[i]);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+    } else {
+        for (size_t i = 0; i < m_channels.size(); i++) run_channel(i, x_scaled, runs[i]);
+    }
+    auto start_combine = Clock::now();
+
+    std::vector<int128_t> outputs(x_scaled.size());
+    std::vector<int64_t> residues(m_channels.size());
+    for (size_t k = 0; k < x_scaled.size(); k++) {
+        for (size_t i = 0; i < m_channels.size(); i++) residues[i] = runs[i].residues[k];
+        outputs[k] = crt_combine(residues, m_moduli);
+    }
+    auto end = Clock::now();
+
+    if (timing) {
+        *timing = CrtTiming();
+        for (const auto& run : runs) {
+            // 병렬이면 가장 느린 채널, 차례로면 합
+            auto accumulate = [&](double& total, double value) {
+                total = m_config.parallel ? std::max(total, value) : total + value;
+            };
+            accumulate(timing->encrypt_ms, run.encrypt_ms);
+            accumulate(timing->eval_ms, run.eval_ms);
+            accumulate(timing->decrypt_ms, run.decrypt_ms);
+            timing->channel_eval_ms.push_back(run.eval_ms);
+        }
+        timing->combine_ms = elapsed_ms(start_combine, end);
+        timing->total_ms = elapsed_ms(start, end);
+    }
+    return outputs;
+}
+
+std::unique_ptr<CrtEvaluator> make_crt_evaluator(const ScaledPolynomial& poly, int64_t x_limit, CrtConfig config) {
+    const int128_t bound = output_bound(poly, x_limit);
+    for (uint32_t ring_dim = config.min_ring_dim; ring_dim <= 131072; ring_dim *= 2) {
+        const auto moduli = choose_crt_moduli(bound, config.moduli, ring_dim);
+        if (moduli.back() >= (uint64_t(1) << 60)) break;
+        try {
+            return std::make_unique<CrtEvaluator>(poly, moduli, ring_dim, config);
+        } catch (const std::exception& e) {
+            // 보통은 이 링 차원에서 보안 수준을 맞출 수 없다는 파라미터 검증 오류. 다른 실패도 가려지지 않도록 기록
+            std::cerr << "CRT 평가기 생성 실패 (링 차원 " << ring_dim << ", 채널 " << moduli.size() << "개): "
+                      << e.what() << std::endl;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_modmath.h"
+#include "he_poly_eval.h"
+
+#include <memory>
+
+// ====== CRT 분할 평문 모듈러스 ======
+// 큰 평문 모듈러스 t 하나 대신 서로소인 작은 슬롯 패킹 소수 t_1..t_k (곱 T > 2 * max|y_scaled|) 마다
+// CryptoContext 를 따로 만들고, 같은 정수 다항식을 채널마다 동시에 (스레드 하나씩) 평가한다.
+// 채널마다 복호화한 잔여 y mod t_i 를 CRT (Garner) 로 합쳐 centered y_scaled mod T 를 얻는다.
+// t_i 가 작으면 잡음 예산이 줄어 같은 뎁스에서 모듈러스 체인이 짧아지므로 128비트 보안을 맞출 수 있다.
+
+// |x_scaled| <= x_limit 인 모든 정수 입력에서 mod 없는 |y_scaled| 의 최댓값
+int128_t output_bound(const ScaledPolynomial& poly, int64_t x_limit);
+
+// t ≡ 1 (mod 2 * ring_dim) 인 서로 다른 소수 count 개 (비슷한 크기, 곱 > 2 * y_bound + 1)
+std::vector<uint64_t> choose_crt_moduli(int128_t y_bound, size_t count, uint32_t ring_dim);
+
+// 모듈러스 곱 T (최대 약 2^126)
+int128_t crt_product(const std::vector<uint64_t>& moduli);
+
+// 잔여 residues[i] (mod moduli[i], 부호 무관) 를 Garner 로 합쳐 (-T/2, T/2] 의 값으로 반환
+int128_t crt_combine(const std::vector<int64_t>& residues, const std::vector<uint64_t>& moduli);
+
+struct CrtConfig {
+    size_t moduli = 3;                                        // 채널 (평문 모듈러스) 수
+    SecurityLevel security = SecurityLevel::HEStd_128_classic;
+    uint32_t min_ring_dim = 8192;                             // 보안 수준을 만족할 때까지 두 배씩 늘린다
+    int openfhe_threads = 1;                                  // 채널 스레드 안에서 OpenFHE(OpenMP) 가 쓸 스레드 수
+    bool parallel = true;                                     // false 면 채널을 차례로 평가 (비교용)
+};
+
+// 한 번의 평가 (슬롯 배치 하나) 의 단계별 시간. 병렬이면 각 단계는 가장 느린 채널 기준
+struct CrtTiming {
+    double encrypt_ms = 0.0;
+    double eval_ms = 0.0;
+    double decrypt_ms = 0.0;
+    double combine_ms = 0.0;     // CRT 합성 (평문)
+    double total_ms = 0.0;       // 벽시계 기준 전체
+    std::vector<double> channel_eval_ms;
+};
+
+struct CrtChannel {
+    uint64_t t = 0;
+    HeContext he;
+    std::unique_ptr<PolyEvaluator> evaluator;
+    size_t towers = 0;           // 신선한 암호문의 RNS 타워 수
+};
+
+class CrtEvaluator {
+public:
+    // moduli 마다 (같은 링 차원, 뎁스, 보안 수준) 컨텍스트를 만든다. 컨텍스트 생성이 실패하면 예외
+    CrtEvaluator(const ScaledPolynomial& poly, const std::vector<uint64_t>& moduli, uint32_t ring_dim,
+                 CrtConfig config);
+
+    // 입력 x_scaled 들 (슬롯 수 이하) 을 채널마다 암호화 -> 평가 -> 복호화하고 CRT 로 합친 y_scaled
+    std::vector<int128_t> evaluate(const std::vector<int64_t>& x_scaled, CrtTiming* timing = nullptr);
+
+    // 채널 병렬 여부 (같은 컨텍스트로 병렬 / 차례 실행을 비교할 때)
+    void set_parallel(bool enabled) { m_config.parallel = enabled; }
+
+    const std::vector<uint64_t>& moduli() const { return m_moduli; }
+    const std::vector<CrtChannel>& channels() const { return m_channels; }
+    uint32_t ring_dim() const { return m_ring_dim; }
+    uint32_t depth() const { return m_depth; }
+    double setup_ms() const { return m_setup_ms; }
+
+private:
+    struct ChannelRun {
+        std::vector<int64_t> residues;
+        double encrypt_ms = 0.0;
+        double eval_ms = 0.0;
+        double decrypt_ms = 0.0;
+    };
+
+    void run_channel(size_t index, const std::vector<int64_t>& x_scaled, ChannelRun& run);
+
+    ScaledPolynomial m_poly;
+    std::vector<uint64_t> m_moduli;
+    uint32_t m_ring_dim;
+    uint32_t m_depth;
+    CrtConfig m_config;
+    std::vector<CrtChannel> m_channels;
+    double m_setup_ms = 0.0;
+};
+
+// |x_scaled| <= x_limit 를 담는 모듈러스를 고르고, 보안 수준을 만족하는 가장 작은 링 차원
+// (config.min_ring_dim 부터 두 배씩, t_i 는 링 차원마다 다시 선택) 으로 평가기를 만든다.
+// 링 차원마다의 생성 실패는 std::cerr 에 이유를 남기고 다음 링 차원을 시도하며, 모두 실패하면 nullptr
+std::unique_ptr<CrtEvaluator> make_crt_evaluator(const ScaledPolynomial& poly, int64_t x_limit, CrtConfig config);
@@ -0,0 +1,91 @@
+#include "he_encrypt_pool.h"
+
+#include <algorithm>
+
+#include <omp.h>
+
+#include "he_trace.h"
+
+EncryptPool::EncryptPool(CryptoContext<DCRTPoly> cc, PublicKey<DCRTPoly> publicKey, EncryptPoolConfig config,
+                         Alarm alarm)
+    : m_cc(std::move(cc)),
+      m_publicKey(std::move(publicKey)),
+      m_config(config),
+      m_alarm(std::move(alarm)),
+      m_zero(m_cc->MakePackedPlaintext(std::vector<int64_t>{0})),
+      m_queue(config.capacity) {
+    m_stats.min_remaining = config.capacity;
+    for (size_t i = 0; i < m_config.refill_threads; i++) {
+        m_threads.emplace_back([this] { refill_loop(); });
+    }
+}
+
+EncryptPool::~EncryptPool() {
+    m_queue.close();
+    for (auto& thread : m_threads) thread.join();
+}
+
+Ciphertext<DCRTPoly> EncryptPool::make_zero() {
+    return m_cc->Encrypt(m_publicKey, m_zero);
+}
+
+void EncryptPool::record_produced(double ms) {
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    m_stats.produced++;
+    m_stats.produce_ms += ms;
+    if (!m_alarm_armed && m_queue.size() >= m_config.low_watermark) m_alarm_armed = true;
+}
+
+void EncryptPool::fill() {
+    while (m_queue.size() < m_config.capacity) {
+        auto start = Clock::now();
+        auto ct = make_zero();
+        const double ms = elapsed_ms(start, Clock::now());
+        // 보충 스레드가 그사이 마지막 빈자리를 채웠을 수 있으므로 기다리지 않는 try_push
+        // (막히는 push 면 보충 스레드와 함께 꺼내는 쪽 없이 영원히 대기)
+        if (!m_queue.try_push(ct)) return;
+        record_produced(ms);
+    }
+}
+
+void EncryptPool::refill_loop() {
+    omp_set_num_threads(m_config.openfhe_threads);
+    while (true) {
+        auto start = Clock::now();
+        auto ct = make_zero();
+        const double ms = elapsed_ms(start, Clock::now());
+        if (!m_queue.push(ct)) return;  // 가득 차면 여기서 대기, close 되면 종료
+        record_produced(ms);
+    }
+}
+
+Ciphertext<DCRTPoly> EncryptPool::encrypt(const Plaintext& pt) {
+    Ciphertext<DCRTPoly> zero;
+    const bool hit = m_queue.try_pop(zero);
+    const size_t remaining = m_queue.size();
+
+    bool raise = false;
+    {
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        if (hit) {
+            m_stats.taken++;
+        } else {
+            m_stats.misses++;
+        }
+        m_stats.min_remaining = std::min(m_stats.min_remaining, remaining);
+        if (m_alarm_armed && remaining < m_config.low_watermark) {
+            m_alarm_armed = false;
+            m_stats.alarms++;
+            raise = true;
+        }
+    }
+    if (raise && m_alarm) m_alarm(remaining);
+
+    if (!hit) return traced_encrypt(m_cc, m_publicKey, pt);
+    return traced_eval_add(m_cc, zero, pt);
+}
+
+EncryptPoolStats EncryptPool::stats() const {
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    return m_stats;
+}
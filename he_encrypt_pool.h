@@ -0,0 +1,70 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_pipeline.h"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// ====== 암호화 풀 (미리 만든 Enc(0)) ======
+// 공개키 암호화 비용 대부분은 새 난수(u, e0, e1) 샘플링과 그 NTT 이다. 백그라운드 스레드가 같은 공개키로
+// 0 의 암호문을 미리 만들어 두고, 온라인 암호화는 메시지 인코딩 + EvalAdd(Enc(0), pt) 한 번만 한다.
+// 각 Enc(0) 는 한 번만 쓰고 버리므로 (재사용 없음) 보안은 매번 Encrypt 하는 것과 같다.
+// BGV / BFV 정수 평문 전용 (0 평문을 MakePackedPlaintext 로 만든다).
+
+struct EncryptPoolConfig {
+    size_t capacity = 64;        // 미리 만들어 둘 Enc(0) 개수
+    size_t refill_threads = 1;   // 백그라운드 보충 스레드 수 (0 이면 fill() 로만 채움)
+    size_t low_watermark = 8;    // 남은 개수가 이 값 아래로 내려가면 알람
+    int openfhe_threads = 1;     // 보충 스레드 안에서 OpenFHE(OpenMP) 가 쓸 스레드 수
+};
+
+struct EncryptPoolStats {
+    size_t produced = 0;         // 만든 Enc(0) 수
+    size_t taken = 0;            // 풀에서 꺼내 쓴 수
+    size_t misses = 0;           // 풀이 비어 바로 Encrypt 한 수
+    size_t alarms = 0;           // low watermark 알람 수 (내려갈 때 한 번, 다시 올라오면 재무장)
+    size_t min_remaining = 0;    // 꺼낸 직후 관측한 최소 남은 개수
+    double produce_ms = 0.0;     // Enc(0) 생성 시간 합 (백그라운드)
+};
+
+class EncryptPool {
+public:
+    // 알람 콜백: (남은 개수). encrypt 를 호출한 스레드에서 불린다
+    using Alarm = std::function<void(size_t)>;
+
+    EncryptPool(CryptoContext<DCRTPoly> cc, PublicKey<DCRTPoly> publicKey, EncryptPoolConfig config,
+                Alarm alarm = nullptr);
+    ~EncryptPool();
+
+    EncryptPool(const EncryptPool&) = delete;
+    EncryptPool& operator=(const EncryptPool&) = delete;
+
+    // 현재 스레드에서 capacity 까지 채운다 (온라인 처리 전 예열). 보충 스레드와 함께 돌아도 막히지 않는다
+    // (가득 차면 마지막에 만든 Enc(0) 하나는 버린다)
+    void fill();
+
+    // Enc(0) + pt. 풀이 비어 있으면 기다리지 않고 바로 Encrypt
+    Ciphertext<DCRTPoly> encrypt(const Plaintext& pt);
+
+    size_t size() const { return m_queue.size(); }
+    EncryptPoolStats stats() const;
+
+private:
+    Ciphertext<DCRTPoly> make_zero();
+    void record_produced(double ms);
+    void refill_loop();
+
+    CryptoContext<DCRTPoly> m_cc;
+    PublicKey<DCRTPoly> m_publicKey;
+    EncryptPoolConfig m_config;
+    Alarm m_alarm;
+    Plaintext m_zero;
+    BoundedQueue<Ciphertext<DCRTPoly>> m_queue;
+    std::vector<std::thread> m_threads;
+
+    mutable std::mutex m_stats_mutex;
+    EncryptPoolStats m_stats;
+    bool m_alarm_armed = true;
+};
@@ -0,0 +1,58 @@
+#include "he_modmath.h"
+
+namespace {
+
+// 이 밑(base) 집합이면 2^64 미만에서 Miller-Rabin 이 결정적
+const uint64_t kWitnesses[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+}  // namespace
+
+uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t m) {
+    return static_cast<uint64_t>(static_cast<uint128_t>(a) * b % m);
+}
+
+uint64_t pow_mod(uint64_t base, uint64_t exp, uint64_t m) {
+    uint64_t result = 1 % m;
+    base %= m;
+    while (exp > 0) {
+        if (exp & 1) result = mul_mod(result, base, m);
+        base = mul_mod(base, base, m);
+        exp >>= 1;
+    }
+    return result;
+}
+
+bool is_prime(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t p : kWitnesses) {
+        if (n % p == 0) return n == p;
+    }
+
+    uint64_t d = n - 1;
+    int r = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        r++;
+    }
+    for (uint64_t a : kWitnesses) {
+        uint64_t x = pow_mod(a, d, n);
+        if (x == 1 || x == n - 1) continue;
+        bool composite = true;
+        for (int i = 1; i < r; i++) {
+            x = mul_mod(x, x, n);
+            if (x == n - 1) {
+                composite = false;
+                break;
+            }
+        }
+        if (composite) return false;
+    }
+    return true;
+}
+
+uint64_t next_packing_prime(uint64_t min_value, uint32_t ring_dim) {
+    const uint64_t m = 2 * static_cast<uint64_t>(ring_dim);
+    uint64_t t = (min_value <= 1 ? 0 : (min_value - 1 + m - 1) / m) * m + 1;
+    while (!is_prime(t)) t += m;
+    return t;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// ====== 128비트 정수 ======
+// GCC/Clang 확장 타입. -Wpedantic 경고가 나지 않도록 __extension__ 으로 한 번만 선언하고 이 이름만 쓴다
+// (OpenFHE basicint.h 의 같은 이름 typedef 와 같은 타입이라 함께 include 해도 충돌하지 않는다)
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+// ====== 모듈러 정수 연산 (평문 모듈러스 선택용) ======
+
+// (a * b) mod m, 128비트 중간값
+uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t m);
+
+// base^exp mod m
+uint64_t pow_mod(uint64_t base, uint64_t exp, uint64_t m);
+
+// 64비트 결정적 Miller-Rabin 소수 판정
+bool is_prime(uint64_t n);
+
+// min_value 이상이고 t ≡ 1 (mod 2 * ring_dim) 인 가장 작은 소수 (BGV 슬롯 패킹 조건)
+uint64_t next_packing_prime(uint64_t min_value, uint32_t ring_dim);
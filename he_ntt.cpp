@@ -0,0 +1,529 @@
+#include "he_ntt.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "he_modmath.h"
+#include "he_util.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define ENC_SIN_NTT_X86 1
+#endif
+
+namespace {
+
+size_t next_pow2(size_t n) {
+    size_t m = 1;
+    while (m < n) m <<= 1;
+    return m;
+}
+
+unsigned log2_exact(size_t n) {
+    unsigned bits = 0;
+    while ((size_t(1) << bits) < n) bits++;
+    return bits;
+}
+
+size_t bit_reverse(size_t x, unsigned bits) {
+    size_t r = 0;
+    for (unsigned i = 0; i < bits; i++) {
+        r = (r << 1) | (x & 1);
+        x >>= 1;
+    }
+    return r;
+}
+
+// ====== Montgomery 곱 (R = 2^32 / 2^64) ======
+// mul(a, b) = a * b * R^-1 mod q. 표에는 R 을 곱해 둔 값(to_mont)을 넣어 두어 mul 결과가 일반 형태로 남게 한다.
+struct Mont32 {
+    using Word = uint32_t;
+    uint32_t q;
+    uint32_t qinv;  // -q^-1 mod 2^32
+
+    explicit Mont32(uint64_t modulus) : q(static_cast<uint32_t>(modulus)) {
+        uint32_t inv = q;  // 홀수 q 에서 q * q ≡ 1 (mod 8), 뉴턴 반복마다 맞는 비트 수가 두 배
+        for (int i = 0; i < 5; i++) inv *= 2 - q * inv;
+        qinv = 0u - inv;
+    }
+    uint32_t mul(uint32_t a, uint32_t b) const {
+        const uint64_t t = static_cast<uint64_t>(a) * b;
+        const uint32_t m = static_cast<uint32_t>(t) * qinv;
+        const uint32_t u = static_cast<uint32_t>((t + static_cast<uint64_t>(m) * q) >> 32);
+        return u >= q ? u - q : u;
+    }
+    uint32_t to_mont(uint64_t x) const { return static_cast<uint32_t>(((x % q) << 32) % q); }
+};
+
+struct Mont64 {
+    using Word = uint64_t;
+    uint64_t q;
+    uint64_t qinv;  // -q^-1 mod 2^64
+
+    explicit Mont64(uint64_t modulus) : q(modulus) {
+        uint64_t inv = q;
+        for (int i = 0; i < 6; i++) inv *= 2 - q * inv;
+        qinv = 0 - inv;
+    }
+    uint64_t mul(uint64_t a, uint64_t b) const {
+        // q < 2^62 이면 t + m * q < 2^127 이라 128비트 안에서 넘치지 않는다
+        const uint128_t t = static_cast<uint128_t>(a) * b;
+        const uint64_t m = static_cast<uint64_t>(t) * qinv;
+        const uint64_t u = static_cast<uint64_t>((t + static_cast<uint128_t>(m) * q) >> 64);
+        return u >= q ? u - q : u;
+    }
+    uint64_t to_mont(uint64_t x) const {
+        return static_cast<uint64_t>((static_cast<uint128_t>(x % q) << 64) % q);
+    }
+};
+
+template <class Word>
+Word add_mod(Word a, Word b, Word q) {
+    const Word s = a + b;
+    return s >= q ? s - q : s;
+}
+
+template <class Word>
+Word sub_mod(Word a, Word b, Word q) {
+    return a >= b ? a - b : a + q - b;
+}
+
+// psi^n = -1 인 2n 차 원시 단위근 (q ≡ 1 mod 2n)
+uint64_t primitive_root_2n(uint64_t q, size_t n) {
+    for (uint64_t g = 2; g < q; g++) {
+        const uint64_t psi = pow_mod(g, (q - 1) / (2 * n), q);
+        if (pow_mod(psi, n, q) == q - 1) return psi;
+    }
+    throw std::runtime_error("2n 차 원시 단위근을 찾을 수 없습니다");
+}
+
+// 크기 n negacyclic NTT 표: psi 거듭제곱을 비트 역순으로 (Montgomery 형태)
+template <class Mont>
+struct NttPlan {
+    using Word = typename Mont::Word;
+    Mont mont;
+    size_t n;
+    std::vector<Word> psi;
+    std::vector<Word> psi_inv;
+    Word scale;  // 역변환 마지막 곱: n^-1 에 점별 Montgomery 곱이 남긴 R^-1 보정까지 (n^-1 * R^2)
+
+    NttPlan(uint64_t q, size_t size) : mont(q), n(size), psi(size), psi_inv(size) {
+        const uint64_t root = primitive_root_2n(q, n);
+        const uint64_t root_inv = pow_mod(root, q - 2, q);
+        const unsigned bits = log2_exact(n);
+        uint64_t p = 1, p_inv = 1;
+        for (size_t i = 0; i < n; i++) {
+            psi[bit_reverse(i, bits)] = mont.to_mont(p);
+            psi_inv[bit_reverse(i, bits)] = mont.to_mont(p_inv);
+            p = mul_mod(p, root, q);
+            p_inv = mul_mod(p_inv, root_inv, q);
+        }
+        scale = mont.to_mont(mont.to_mont(pow_mod(n % q, q - 2, q)));
+    }
+};
+
+// (q, n) 별 표 캐시 (여러 스레드에서 호출 가능)
+template <class Mont>
+std::shared_ptr<const NttPlan<Mont>> get_plan(uint64_t q, size_t n) {
+    static std::mutex mutex;
+    static std::map<std::pair<uint64_t, size_t>, std::shared_ptr<const NttPlan<Mont>>> plans;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& plan = plans[{q, n}];
+    if (!plan) plan = std::make_shared<const NttPlan<Mont>>(q, n);
+    return plan;
+}
+
+// ====== 스칼라 커널 ======
+struct ScalarOps {
+    static constexpr size_t width = 0;  // 블록 벡터화 없음
+};
+
+template <class Mont>
+void forward_butterflies(const Mont& mont, typename Mont::Word* x, typename Mont::Word* y, size_t t,
+                         typename Mont::Word s) {
+    for (size_t j = 0; j < t; j++) {
+        const auto u = x[j];
+        const auto v = mont.mul(y[j], s);
+        x[j] = add_mod(u, v, mont.q);
+        y[j] = sub_mod(u, v, mont.q);
+    }
+}
+
+template <class Mont>
+void inverse_butterflies(const Mont& mont, typename Mont::Word* x, typename Mont::Word* y, size_t t,
+                         typename Mont::Word s) {
+    for (size_t j = 0; j < t; j++) {
+        const auto u = x[j];
+        const auto v = y[j];
+        x[j] = add_mod(u, v, mont.q);
+        y[j] = mont.mul(sub_mod(u, v, mont.q), s);
+    }
+}
+
+template <class Mont>
+void multiply_scalar(const Mont& mont, typename Mont::Word* a, const typename Mont::Word* b, size_t n) {
+    for (size_t j = 0; j < n; j++) a[j] = mont.mul(a[j], b[j]);
+}
+
+template <class Mont>
+void scale_scalar(const Mont& mont, typename Mont::Word* a, size_t n, typename Mont::Word s) {
+    for (size_t j = 0; j < n; j++) a[j] = mont.mul(a[j], s);
+}
+
+#ifdef ENC_SIN_NTT_X86
+// ====== AVX2 커널 (32비트 레인 8개) ======
+// _mm256_mul_epu32 는 짝수 레인만 곱하므로 짝수/홀수 레인을 나눠 64비트 곱을 만든 뒤 상위 32비트를 다시 섞는다.
+// 조건부 뺄셈은 min_epu32(r, r - q) (r < q 이면 r - q 가 언더플로우해 큰 값이 된다).
+struct Avx2Ops {
+    static constexpr size_t width = 8;
+
+    __attribute__((target("avx2"))) static inline __m256i mont_mul(__m256i a, __m256i b, __m256i q, __m256i qinv) {
+        const __m256i t_even = _mm256_mul_epu32(a, b);
+        const __m256i t_odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        const __m256i u_even = _mm256_add_epi64(t_even, _mm256_mul_epu32(_mm256_mul_epu32(t_even, qinv), q));
+        const __m256i u_odd = _mm256_add_epi64(t_odd, _mm256_mul_epu32(_mm256_mul_epu32(t_odd, qinv), q));
+        const __m256i r = _mm256_blend_epi32(_mm256_srli_epi64(u_even, 32), u_odd, 0xAA);
+        return _mm256_min_epu32(r, _mm256_sub_epi32(r, q));
+    }
+    __attribute__((target("avx2"))) static inline __m256i add(__m256i a, __m256i b, __m256i q) {
+        const __m256i s = _mm256_add_epi32(a, b);
+        return _mm256_min_epu32(s, _mm256_sub_epi32(s, q));
+    }
+    __attribute__((target("avx2"))) static inline __m256i sub(__m256i a, __m256i b, __m256i q) {
+        const __m256i d = _mm256_sub_epi32(a, b);
+        return _mm256_min_epu32(d, _mm256_add_epi32(d, q));
+    }
+
+    __attribute__((target("avx2"))) static void forward(const Mont32& mont, uint32_t* x, uint32_t* y, size_t t, uint32_t s) {
+        const __m256i q = _mm256_set1_epi32(static_cast<int>(mont.q));
+        const __m256i qinv = _mm256_set1_epi32(static_cast<int>(mont.qinv));
+        const __m256i vs = _mm256_set1_epi32(static_cast<int>(s));
+        for (size_t j = 0; j < t; j += width) {
+            const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + j));
+            const __m256i v = mont_mul(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + j)), vs, q, qinv);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + j), add(u, v, q));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + j), sub(u, v, q));
+        }
+    }
+    __attribute__((target("avx2"))) static void inverse(const Mont32& mont, uint32_t* x, uint32_t* y, size_t t, uint32_t s) {
+        const __m256i q = _mm256_set1_epi32(static_cast<int>(mont.q));
+        const __m256i qinv = _mm256_set1_epi32(static_cast<int>(mont.qinv));
+        const __m256i vs = _mm256_set1_epi32(static_cast<int>(s));
+        for (size_t j = 0; j < t; j += width) {
+            const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + j));
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + j), add(u, v, q));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + j), mont_mul(sub(u, v, q), vs, q, qinv));
+        }
+    }
+    __attribute__((target("avx2"))) static void multiply(const Mont32& mont, uint32_t* a, const uint32_t* b, size_t n) {
+        const __m256i q = _mm256_set1_epi32(static_cast<int>(mont.q));
+        const __m256i qinv = _mm256_set1_epi32(static_cast<int>(mont.qinv));
+        for (size_t j = 0; j < n; j += width) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j), mont_mul(va, vb, q, qinv));
+        }
+    }
+};
+
+// ====== AVX-512 커널 (32비트 레인 16개) ======
+// GCC 12 -O3 는 avx512fintrin.h 의 마스크 없는 인트린식이 내부에서 쓰는 _mm512_undefined_epi32() 통과값(__Y)을
+// 미초기화 사용으로 오판해 -Wmaybe-uninitialized 를 낸다 (이 커널의 임시값은 모두 초기화되어 있음, GCC PR105593).
+// 이 커널에서만 끈다.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+struct Avx512Ops {
+    static constexpr size_t width = 16;
+
+    __attribute__((target("avx512f"))) static inline __m512i mont_mul(__m512i a, __m512i b, __m512i q, __m512i qinv) {
+        const __m512i t_even = _mm512_mul_epu32(a, b);
+        const __m512i t_odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+        const __m512i u_even = _mm512_add_epi64(t_even, _mm512_mul_epu32(_mm512_mul_epu32(t_even, qinv), q));
+        const __m512i u_odd = _mm512_add_epi64(t_odd, _mm512_mul_epu32(_mm512_mul_epu32(t_odd, qinv), q));
+        const __m512i r = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(u_even, 32), u_odd);
+        return _mm512_min_epu32(r, _mm512_sub_epi32(r, q));
+    }
+    __attribute__((target("avx512f"))) static inline __m512i add(__m512i a, __m512i b, __m512i q) {
+        const __m512i s = _mm512_add_epi32(a, b);
+        return _mm512_min_epu32(s, _mm512_sub_epi32(s, q));
+    }
+    __attribute__((target("avx512f"))) static inline __m512i sub(__m512i a, __m512i b, __m512i q) {
+        const __m512i d = _mm512_sub_epi32(a, b);
+        return _mm512_min_epu32(d, _mm512_add_epi32(d, q));
+    }
+
+    __attribute__((target("avx512f"))) static void forward(const Mont32& mont, uint32_t* x, uint32_t* y, size_t t, uint32_t s) {
+        const __m512i q = _mm512_set1_epi32(static_cast<int>(mont.q));
+        const __m512i qinv = _mm512_set1_epi32(static_cast<int>(mont.qinv));
+        const __m512i vs = _mm512_set1_epi32(static_cast<int>(s));
+        for (size_t j = 0; j < t; j += width) {
+            const __m512i u = _mm512_loadu_si512(x + j);
+            const __m512i v = mont_mul(_mm512_loadu_si512(y + j), vs, q, qinv);
+            _mm512_storeu_si512(x + j, add(u, v, q));
+            _mm512_storeu_si512(y + j, sub(u, v, q));
+        }
+    }
+    __attribute__((target("avx512f"))) static void inverse(const Mont32& mont, uint32_t* x, uint32_t* y, size_t t, uint32_t s) {
+        const __m512i q = _mm512_set1_epi32(static_cast<int>(mont.q));
+        const __m512i qinv = _mm512_set1_epi32(static_cast<int>(mont.qinv));
+        const __m512i vs = _mm512_set1_epi32(static_cast<int>(s));
+        for (size_t j = 0; j < t; j += width) {
+            const __m512i u = _mm512_loadu_si512(x + j);
+            const __m512i v = _mm512_loadu_si512(y + j);
+            _mm512_storeu_si512(x + j, add(u, v, q));
+            _mm512_storeu_si512(y + j, mont_mul(sub(u, v, q), vs, q, qinv));
+        }
+    }
+    __attribute__((target("avx512f"))) static void multiply(const Mont32& mont, uint32_t* a, const uint32_t* b, size_t n) {
+        const __m512i q = _mm512_set1_epi32(static_cast<int>(mont.q));
+        const __m512i qinv = _mm512_set1_epi32(static_cast<int>(mont.qinv));
+        for (size_t j = 0; j < n; j += width) {
+            _mm512_storeu_si512(a + j, mont_mul(_mm512_loadu_si512(a + j), _mm512_loadu_si512(b + j), q, qinv));
+        }
+    }
+};
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+// ====== 변환 ======
+// 순방향: Cooley-Tukey (자연 순서 입력 -> 비트 역순 출력), 역방향: Gentleman-Sande (비트 역순 -> 자연 순서).
+// psi 를 표에 섞어 두어 X^n + 1 로의 감김(negacyclic)이 변환 안에서 처리된다.
+// 블록 길이 t 가 벡터 폭 이상이면 Ops 의 벡터 버터플라이, 아니면 스칼라 버터플라이.
+template <class Ops, class Mont>
+void forward_ntt(const NttPlan<Mont>& plan, typename Mont::Word* a) {
+    size_t t = plan.n;
+    for (size_t m = 1; m < plan.n; m <<= 1) {
+        t >>= 1;
+        for (size_t i = 0; i < m; i++) {
+            auto* x = a + 2 * i * t;
+            if constexpr (Ops::width > 0) {
+                if (t >= Ops::width) {
+                    Ops::forward(plan.mont, x, x + t, t, plan.psi[m + i]);
+                    continue;
+                }
+            }
+            forward_butterflies(plan.mont, x, x + t, t, plan.psi[m + i]);
+        }
+    }
+}
+
+template <class Ops, class Mont>
+void inverse_ntt(const NttPlan<Mont>& plan, typename Mont::Word* a) {
+    size_t t = 1;
+    for (size_t m = plan.n; m > 1; m >>= 1) {
+        const size_t h = m >> 1;
+        for (size_t i = 0; i < h; i++) {
+            auto* x = a + 2 * i * t;
+            if constexpr (Ops::width > 0) {
+                if (t >= Ops::width) {
+                    Ops::inverse(plan.mont, x, x + t, t, plan.psi_inv[h + i]);
+                    continue;
+                }
+            }
+            inverse_butterflies(plan.mont, x, x + t, t, plan.psi_inv[h + i]);
+        }
+        t <<= 1;
+    }
+    scale_scalar(plan.mont, a, plan.n, plan.scale);
+}
+
+template <class Ops, class Mont>
+void pointwise(const NttPlan<Mont>& plan, typename Mont::Word* a, const typename Mont::Word* b) {
+    if constexpr (Ops::width > 0) {
+        if (plan.n >= Ops::width) {
+            Ops::multiply(plan.mont, a, b, plan.n);
+            return;
+        }
+    }
+    multiply_scalar(plan.mont, a, b, plan.n);
+}
+
+// a, b (값은 [0, q)) 의 선형 합성곱 mod q, 길이 size (size 는 2의 거듭제곱, |a| + |b| - 1 <= size)
+template <class Ops, class Mont>
+std::vector<uint64_t> convolve_with(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, uint64_t q, size_t size) {
+    using Word = typename Mont::Word;
+    const auto plan = get_plan<Mont>(q, size);
+    std::vector<Word> fa(size, 0), fb(size, 0);
+    for (size_t i = 0; i < a.size(); i++) fa[i] = static_cast<Word>(a[i] % q);
+    for (size_t i = 0; i < b.size(); i++) fb[i] = static_cast<Word>(b[i] % q);
+
+    forward_ntt<Ops>(*plan, fa.data());
+    forward_ntt<Ops>(*plan, fb.data());
+    pointwise<Ops>(*plan, fa.data(), fb.data());
+    inverse_ntt<Ops>(*plan, fa.data());
+    return std::vector<uint64_t>(fa.begin(), fa.end());
+}
+
+std::vector<uint64_t> convolve_mod(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, uint64_t q,
+                                   size_t size, NttKernel kernel) {
+    if (q >= (uint64_t(1) << 31)) return convolve_with<ScalarOps, Mont64>(a, b, q, size);
+#ifdef ENC_SIN_NTT_X86
+    if (kernel == NttKernel::Avx512) return convolve_with<Avx512Ops, Mont32>(a, b, q, size);
+    if (kernel == NttKernel::Avx2) return convolve_with<Avx2Ops, Mont32>(a, b, q, size);
+#endif
+    (void)kernel;
+    return convolve_with<ScalarOps, Mont32>(a, b, q, size);
+}
+
+bool ntt_friendly(uint64_t t, size_t size) {
+    return t > 2 && t < (uint64_t(1) << 62) && (t - 1) % (2 * size) == 0 && is_prime(t);
+}
+
+// q ≡ 1 (mod 2 * size) 인 31비트 소수들 (큰 것부터), 곱이 2^bits 를 넘을 때까지
+std::vector<uint64_t> crt_primes(size_t size, double bits) {
+    static std::mutex mutex;
+    static std::map<size_t, std::vector<uint64_t>> cache;  // size 별 소수 목록 (필요한 만큼 늘림)
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& primes = cache[size];
+
+    const uint64_t step = 2 * size;
+    uint64_t candidate = primes.empty() ? ((uint64_t(1) << 31) - 1) / step * step + 1 : primes.back() - step;
+    double have = 0.0;
+    for (uint64_t p : primes) have += std::log2(static_cast<double>(p));
+    while (have <= bits) {
+        while (candidate > step && !is_prime(candidate)) candidate -= step;
+        if (candidate <= step) throw std::runtime_error("CRT 용 NTT 소수가 부족합니다");
+        primes.push_back(candidate);
+        have += std::log2(static_cast<double>(candidate));
+        candidate -= step;
+    }
+
+    std::vector<uint64_t> used;
+    double sum = 0.0;
+    for (uint64_t p : primes) {
+        if (sum > bits) break;
+        used.push_back(p);
+        sum += std::log2(static_cast<double>(p));
+    }
+    return used;
+}
+
+// 선형 합성곱 항의 상한 비트 수: min(|a|, |b|) * (t - 1)^2
+double convolution_bits(size_t a_size, size_t b_size, int64_t t) {
+    return std::log2(static_cast<double>(std::min(a_size, b_size))) + 2.0 * std::log2(static_cast<double>(t)) + 1.0;
+}
+
+}  // namespace
+
+bool ntt_kernel_supported(NttKernel kernel) {
+#ifdef ENC_SIN_NTT_X86
+    if (kernel == NttKernel::Avx512) return __builtin_cpu_supports("avx512f");
+    if (kernel == NttKernel::Avx2) return __builtin_cpu_supports("avx2");
+#endif
+    return kernel == NttKernel::Scalar;
+}
+
+NttKernel best_ntt_kernel() {
+    if (ntt_kernel_supported(NttKernel::Avx512)) return NttKernel::Avx512;
+    if (ntt_kernel_supported(NttKernel::Avx2)) return NttKernel::Avx2;
+    return NttKernel::Scalar;
+}
+
+const char* ntt_kernel_name(NttKernel kernel) {
+    switch (kernel) {
+        case NttKernel::Avx512: return "avx512";
+        case NttKernel::Avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+std::string ntt_path(size_t a_size, size_t b_size, int64_t t) {
+    if (a_size == 0 || b_size == 0) return "-";
+    const size_t size = next_pow2(a_size + b_size - 1);
+    if (ntt_friendly(static_cast<uint64_t>(t), size)) {
+        return static_cast<uint64_t>(t) < (uint64_t(1) << 31) ? "mod t 직접 (32비트 Montgomery)" : "mod t 직접 (64비트 Montgomery)";
+    }
+    return "CRT 31비트 소수 " + std::to_string(crt_primes(size, convolution_bits(a_size, b_size, t)).size()) + "개";
+}
+
+std::vector<int64_t> ntt_multiply(const std::vector<int64_t>& a, const std::vector<int64_t>& b, int64_t t,
+                                  size_t ring_dim, NttKernel kernel) {
+    if (a.empty() || b.empty()) return {};
+    if (!ntt_kernel_supported(kernel)) kernel = NttKernel::Scalar;
+
+    const uint64_t ut = static_cast<uint64_t>(t);
+    std::vector<uint64_t> ua(a.size()), ub(b.size());
+    for (size_t i = 0; i < a.size(); i++) ua[i] = static_cast<uint64_t>(((a[i] % t) + t) % t);
+    for (size_t i = 0; i < b.size(); i++) ub[i] = static_cast<uint64_t>(((b[i] % t) + t) % t);
+
+    const size_t length = a.size() + b.size() - 1;
+    const size_t size = next_pow2(length);
+
+    // 선형 합성곱 mod t (길이 length)
+    std::vector<uint64_t> linear;
+    if (ntt_friendly(ut, size)) {
+        linear = convolve_mod(ua, ub, ut, size, kernel);
+    } else {
+        // [0, t) 입력의 정확한 합성곱 < min(|a|, |b|) * t^2 을 소수별로 구한 뒤 Garner 로 mod t 복원
+        const auto primes = crt_primes(size, convolution_bits(a.size(), b.size(), t));
+        const size_t k = primes.size();
+        std::vector<std::vector<uint64_t>> residues(k);
+        for (size_t i = 0; i < k; i++) residues[i] = convolve_mod(ua, ub, primes[i], size, kernel);
+
+        // inv[i][j] = p_j^-1 mod p_i (j < i), prefix[i] = p_0 * ... * p_{i-1} mod t
+        std::vector<std::vector<uint64_t>> inv(k, std::vector<uint64_t>(k, 0));
+        std::vector<uint64_t> prefix(k, 1 % ut);
+        for (size_t i = 0; i < k; i++) {
+            for (size_t j = 0; j < i; j++) inv[i][j] = pow_mod(primes[j] % primes[i], primes[i] - 2, primes[i]);
+            if (i > 0) prefix[i] = mul_mod(prefix[i - 1], primes[i - 1] % ut, ut);
+        }
+
+        linear.assign(size, 0);
+        std::vector<uint64_t> digits(k);
+        for (size_t c = 0; c < length; c++) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < k; i++) {
+                uint64_t v = residues[i][c];
+                for (size_t j = 0; j < i; j++) {
+                    v = mul_mod(sub_mod<uint64_t>(v, digits[j] % primes[i], primes[i]), inv[i][j], primes[i]);
+                }
+                digits[i] = v;
+                value = (value + mul_mod(v % ut, prefix[i], ut)) % ut;
+            }
+            linear[c] = value;
+        }
+    }
+
+    // X^N = -1 로 감기: c_k - c_{k+N}
+    std::vector<int64_t> result(std::min(length, ring_dim));
+    for (size_t c = 0; c < result.size(); c++) {
+        uint64_t value = linear[c];
+        for (size_t wrap = c + ring_dim, sign = 1; wrap < length; wrap += ring_dim, sign ^= 1) {
+            value = sign ? sub_mod<uint64_t>(value, linear[wrap], ut) : add_mod<uint64_t>(value, linear[wrap], ut);
+        }
+        const int64_t v = static_cast<int64_t>(value);
+        result[c] = v > t / 2 ? v - t : v;
+    }
+    return result;
+}
+
+std::vector<int64_t> negacyclic_multiply(const std::vector<int64_t>& a, const std::vector<int64_t>& b, int64_t t,
+                                         size_t ring_dim) {
+    if (a.empty() || b.empty()) return {};
+    std::vector<int128_t> acc(std::min(a.size() + b.size() - 1, ring_dim), 0);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            // X^(i+j) = -X^(i+j-N) (X^N = -1)
+            const int128_t product = static_cast<int128_t>(a[i]) * b[j];
+            const size_t k = i + j;
+            if (k < ring_dim) {
+                acc[k] = (acc[k] + product) % t;
+            } else {
+                acc[k - ring_dim] = (acc[k - ring_dim] - product) % t;
+            }
+        }
+    }
+    std::vector<int64_t> result(acc.size());
+    for (size_t k = 0; k < acc.size(); k++) result[k] = centered_mod(static_cast<int64_t>(acc[k]), t);
+    return result;
+}
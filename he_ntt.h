@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ====== NTT 기반 평문 다항식 곱 (암호문 결과 검증용 기준) ======
+// negacyclic_multiply (O(n1 * n2)) 와 같은 결과를 O(M log M) 으로 계산한다 (M = 선형 합성곱 길이 이상인 2의 거듭제곱).
+// - t 가 소수이고 t ≡ 1 (mod 2M) 이면 mod t 에서 바로 NTT (65537: M <= 2^15, 7340033: M <= 2^19, 593779228673: M <= 2^29)
+// - 아니면 31비트 NTT 소수 여러 개에서 정확한 선형 합성곱을 구하고 Garner CRT 로 mod t 값을 복원
+// 모듈러 곱은 Montgomery: 31비트 이하 모듈러스는 32비트 레인을 AVX-512 / AVX2 로 벡터화 (스칼라 대체 경로 포함),
+// 그보다 큰 모듈러스는 128비트 중간값을 쓰는 64비트 Montgomery (스칼라).
+
+// 평문 기준: Z_t[X] / (X^N + 1) 에서 a * b (centered 계수, ring_dim = N, |a|, |b| <= N). 결과 길이 min(|a| + |b| - 1, N)
+// O(|a| * |b|) 이중 루프라 큰 n 에서는 같은 결과를 내는 아래 ntt_multiply 를 쓴다
+std::vector<int64_t> negacyclic_multiply(const std::vector<int64_t>& a, const std::vector<int64_t>& b, int64_t t,
+                                         size_t ring_dim);
+
+enum class NttKernel { Scalar, Avx2, Avx512 };
+
+// 현재 CPU 에서 쓸 수 있는 가장 넓은 커널
+NttKernel best_ntt_kernel();
+
+bool ntt_kernel_supported(NttKernel kernel);
+
+const char* ntt_kernel_name(NttKernel kernel);
+
+// Z_t[X] / (X^N + 1) 에서 a * b (centered 계수, 길이 min(|a| + |b| - 1, N)). negacyclic_multiply 와 같은 결과
+std::vector<int64_t> ntt_multiply(const std::vector<int64_t>& a, const std::vector<int64_t>& b, int64_t t,
+                                  size_t ring_dim, NttKernel kernel = best_ntt_kernel());
+
+// 위 호출이 고르는 경로 설명 (mod t 직접 / CRT 소수 개수)
+std::string ntt_path(size_t a_size, size_t b_size, int64_t t);
@@ -0,0 +1,128 @@
+#include "he_pipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <omp.h>
+
+namespace {
+
+struct WorkItem {
+    size_t index = 0;   // 암호문 번호
+    size_t offset = 0;  // inputs 에서의 시작 위치
+    size_t count = 0;   // 담긴 값 개수
+    Ciphertext<DCRTPoly> ct;
+};
+
+}  // namespace
+
+PipelineReport run_pipeline(const CryptoContext<DCRTPoly>& cc,
+                            const KeyPair<DCRTPoly>& keyPair,
+                            const ScaledPolynomial& poly,
+                            const std::vector<int64_t>& inputs,
+                            const PipelineConfig& config,
+                            std::vector<int64_t>& outputs) {
+    const size_t slots = slot_count(cc);
+    const size_t per_item = config.values_per_item > 0 ? std::min(config.values_per_item, slots) : slots;
+    const size_t n_items = (inputs.size() + per_item - 1) / per_item;
+    const int64_t t = static_cast<int64_t>(cc->GetEncodingParams()->GetPlaintextModulus());
+
+    outputs.assign(inputs.size(), 0);
+    std::vector<Clock::time_point> started(n_items);
+    std::vector<double> latencies(n_items, 0.0);
+
+    BoundedQueue<WorkItem> to_eval(config.queue_capacity);
+    BoundedQueue<WorkItem> to_decrypt(config.queue_capacity);
+    std::atomic<size_t> next_item{0};
+    std::atomic<size_t> encrypt_alive{std::max<size_t>(1, config.encrypt_threads)};
+    std::atomic<size_t> eval_alive{std::max<size_t>(1, config.eval_threads)};
+
+    // 모든 평가 워커가 같은 계수 평문 캐시를 공유
+    auto coeffs = std::make_shared<CoeffStore>(cc);
+
+    // 워커 하나가 예외를 던지면 첫 예외만 보관하고 두 큐를 닫아 나머지 워커를 깨운 뒤, join 이 끝나면 다시 던진다
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto guarded = [&](auto body) {
+        return [&, body] {
+            try {
+                body();
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (!failure) failure = std::current_exception();
+                }
+                to_eval.close();
+                to_decrypt.close();
+            }
+        };
+    };
+
+    // OpenMP 스레드 수는 스레드별 설정이므로 워커마다 지정해야 두 단계 병렬화가 코어를 과점유하지 않는다
+    const int openfhe_threads = std::max(1, config.openfhe_threads);
+    auto encrypt_worker = [&] {
+        omp_set_num_threads(openfhe_threads);
+        for (size_t i = next_item++; i < n_items; i = next_item++) {
+            WorkItem item;
+            item.index = i;
+            item.offset = i * per_item;
+            item.count = std::min(per_item, inputs.size() - item.offset);
+            started[i] = Clock::now();
+            std::vector<int64_t> chunk(inputs.begin() + item.offset, inputs.begin() + item.offset + item.count);
+            item.ct = cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext(chunk));
+            if (!to_eval.push(std::move(item))) break;  // 다른 워커 실패로 닫힘
+        }
+        if (--encrypt_alive == 0) to_eval.close();
+    };
+
+    auto eval_worker = [&] {
+        omp_set_num_threads(openfhe_threads);
+        PolyEvaluator evaluator(cc, coeffs);
+        WorkItem item;
+        while (to_eval.pop(item)) {
+            item.ct = evaluator.evaluate(item.ct, poly);
+            if (!to_decrypt.push(std::move(item))) break;
+        }
+        if (--eval_alive == 0) to_decrypt.close();
+    };
+
+    auto decrypt_worker = [&] {
+        omp_set_num_threads(openfhe_threads);
+        WorkItem item;
+        while (to_decrypt.pop(item)) {
+            Plaintext p_y;
+            cc->Decrypt(keyPair.secretKey, item.ct, &p_y);
+            p_y->SetLength(item.count);
+            const auto& packed = p_y->GetPackedValue();
+            for (size_t i = 0; i < item.count; i++) {
+                outputs[item.offset + i] = centered_mod(packed[i], t);
+            }
+            latencies[item.index] = elapsed_ms(started[item.index], Clock::now());
+        }
+    };
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::max<size_t>(1, config.encrypt_threads); i++) workers.emplace_back(guarded(encrypt_worker));
+    for (size_t i = 0; i < std::max<size_t>(1, config.eval_threads); i++) workers.emplace_back(guarded(eval_worker));
+    for (size_t i = 0; i < std::max<size_t>(1, config.decrypt_threads); i++) workers.emplace_back(guarded(decrypt_worker));
+    for (auto& worker : workers) worker.join();
+    auto end = Clock::now();
+    if (failure) std::rethrow_exception(failure);
+
+    PipelineReport report;
+    report.items = n_items;
+    report.values = inputs.size();
+    report.wall_ms = elapsed_ms(start, end);
+    report.values_per_sec = report.wall_ms > 0.0 ? inputs.size() * 1000.0 / report.wall_ms : 0.0;
+
+    std::sort(latencies.begin(), latencies.end());
+    report.latency_p50_ms = percentile(latencies, 50.0);
+    report.latency_p90_ms = percentile(latencies, 90.0);
+    report.latency_p99_ms = percentile(latencies, 99.0);
+    report.latency_max_ms = latencies.empty() ? 0.0 : latencies.back();
+    return report;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_poly_eval.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// ====== 제한 크기 블로킹 큐 ======
+// 파이프라인 단계 사이 연결용. 가득 차면 push 가, 비어 있으면 pop 이 대기한다.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : m_capacity(capacity > 0 ? capacity : 1) {}
+
+    // close 된 뒤에는 false
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_full.wait(lock, [&] { return m_closed || m_items.size() < m_capacity; });
+        if (m_closed) return false;
+        m_items.push_back(std::move(item));
+        m_not_empty.notify_one();
+        return true;
+    }
+
+    // close 되고 비어 있으면 false
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty.wait(lock, [&] { return m_closed || !m_items.empty(); });
+        if (m_items.empty()) return false;
+        item = std::move(m_items.front());
+        m_items.pop_front();
+        m_not_full.notify_one();
+        return true;
+    }
+
+    // 가득 찼거나 close 된 뒤에는 기다리지 않고 false
+    bool try_push(T item) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed || m_items.size() >= m_capacity) return false;
+        m_items.push_back(std::move(item));
+        m_not_empty.notify_one();
+        return true;
+    }
+
+    // 비어 있으면 기다리지 않고 false
+    bool try_pop(T& item) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_items.empty()) return false;
+        item = std::move(m_items.front());
+        m_items.pop_front();
+        m_not_full.notify_one();
+        return true;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_items.size();
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_not_empty.notify_all();
+        m_not_full.notify_all();
+    }
+
+private:
+    const size_t m_capacity;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    std::deque<T> m_items;
+    bool m_closed = false;
+};
+
+// ====== 암호화 -> 평가 -> 복호화 파이프라인 ======
+struct PipelineConfig {
+    size_t encrypt_threads = 1;
+    size_t eval_threads = 1;
+    size_t decrypt_threads = 1;
+    size_t queue_capacity = 4;   // 단계 사이 큐 크기 (암호문 개수)
+    size_t values_per_item = 0;  // 암호문 하나에 담을 값 개수 (0 = slot_count)
+    int openfhe_threads = 1;     // 각 워커 안에서 OpenFHE(OpenMP) 가 쓸 스레드 수
+};
+
+struct PipelineReport {
+    size_t items = 0;        // 처리한 암호문 수
+    size_t values = 0;       // 처리한 값 수
+    double wall_ms = 0.0;
+    double values_per_sec = 0.0;
+    // 암호문 하나가 암호화 시작부터 복호화 끝까지 걸린 시간 (ms)
+    double latency_p50_ms = 0.0;
+    double latency_p90_ms = 0.0;
+    double latency_p99_ms = 0.0;
+    double latency_max_ms = 0.0;
+};
+
+// inputs 를 values_per_item 단위로 나눠 파이프라인으로 평가, outputs 에 입력 순서대로 y_scaled 저장
+// 워커에서 난 예외는 모든 워커를 멈추고 join 한 뒤 호출자에게 다시 던진다 (openfhe_threads < 1 은 1 로 취급)
+PipelineReport run_pipeline(const CryptoContext<DCRTPoly>& cc,
+                            const KeyPair<DCRTPoly>& keyPair,
+                            const ScaledPolynomial& poly,
+                            const std::vector<int64_t>& inputs,
+                            const PipelineConfig& config,
+                            std::vector<int64_t>& outputs);
@@ -0,0 +1,279 @@
+#include "he_poly_eval.h"
+
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+#include "he_modmath.h"
+#include "he_trace.h"
+
+namespace {
+
+// x^k 를 최소 뎁스로 만들 때의 뎁스 = ceil(log2 k)
+uint32_t power_depth_of(size_t k) {
+    uint32_t depth = 0;
+    while ((size_t(1) << depth) < k) depth++;
+    return depth;
+}
+
+// a + b = k, max(depth(a), depth(b)) + 1 == depth(k) 인 분할 중 새로 계산할 거듭제곱이 가장 적은 a 선택
+template <class Has>
+size_t choose_split(size_t k, const Has& has) {
+    const uint32_t target = power_depth_of(k);
+    size_t best_a = 0;
+    int best_missing = 3;
+    for (size_t a = k - 1; a >= (k + 1) / 2; a--) {
+        size_t b = k - a;
+        if (std::max(power_depth_of(a), power_depth_of(b)) + 1 > target) continue;
+        int missing = (has(a) ? 0 : 1) + (has(b) ? 0 : 1);
+        if (missing < best_missing) {
+            best_missing = missing;
+            best_a = a;
+        }
+    }
+    return best_a;
+}
+
+// factors 에는 다른 거듭제곱의 인수로 쓰이는 거듭제곱을 모은다
+void plan_power(size_t k, std::set<size_t>& powers, PolyEvalStats& stats, std::set<size_t>& factors) {
+    if (powers.count(k)) return;
+    size_t a = choose_split(k, [&](size_t j) { return powers.count(j) > 0; });
+    plan_power(a, powers, stats, factors);
+    plan_power(k - a, powers, stats, factors);
+    factors.insert(a);
+    factors.insert(k - a);
+    powers.insert(k);
+    stats.ct_mults++;
+    stats.power_depth = std::max(stats.power_depth, power_depth_of(k));
+}
+
+}  // namespace
+
+ScaledPolynomial make_taylor_sin(size_t degree, int64_t s, int64_t denom) {
+    if (degree < 1) throw std::invalid_argument("sin 테일러 차수는 1 이상이어야 합니다");
+    if (degree % 2 == 0) degree--;  // sin 은 홀수 차수 항만 존재
+
+    ScaledPolynomial poly;
+    poly.coeffs.assign(degree + 1, 0);
+    poly.s = s;
+    poly.scale = static_cast<double>(denom) * std::pow(static_cast<double>(s), degree);
+
+    long double factorial = 1.0L;
+    for (size_t k = 1; k <= degree; k++) {
+        factorial *= k;
+        if (k % 2 == 0) continue;
+        long double c = ((k / 2) % 2 == 0 ? 1.0L : -1.0L) / factorial;
+        poly.coeffs[k] = static_cast<int64_t>(std::llround(c * denom * std::pow(static_cast<long double>(s), degree - k)));
+    }
+    return poly;
+}
+
+ScaledPolynomial make_taylor_cos(size_t degree, int64_t s, int64_t denom) {
+    if (degree % 2 == 1) degree--;  // cos 는 짝수 차수 항만 존재
+
+    ScaledPolynomial poly;
+    poly.coeffs.assign(degree + 1, 0);
+    poly.s = s;
+    poly.scale = static_cast<double>(denom) * std::pow(static_cast<double>(s), degree);
+
+    long double factorial = 1.0L;
+    for (size_t k = 0; k <= degree; k++) {
+        if (k > 0) factorial *= k;
+        if (k % 2 == 1) continue;
+        long double c = ((k / 2) % 2 == 0 ? 1.0L : -1.0L) / factorial;
+        poly.coeffs[k] = static_cast<int64_t>(std::llround(c * denom * std::pow(static_cast<long double>(s), degree - k)));
+    }
+    return poly;
+}
+
+int64_t eval_scaled_plain(const ScaledPolynomial& poly, int64_t x_scaled, int64_t t) {
+    // Horner, 매 단계 mod t 로 줄여 int128_t 범위를 넘지 않게 한다
+    int128_t acc = 0;
+    int128_t x = x_scaled % t;
+    for (size_t k = poly.coeffs.size(); k-- > 0;) {
+        acc = (acc * x + poly.coeffs[k]) % t;
+    }
+    return centered_mod(static_cast<int64_t>(acc), t);
+}
+
+bool output_in_range(const ScaledPolynomial& poly, int64_t x_scaled, int64_t t) {
+    int128_t acc = 0;
+    for (size_t k = poly.coeffs.size(); k-- > 0;) {
+        acc = acc * x_scaled + poly.coeffs[k];
+    }
+    return acc < t / 2 && acc > -(t / 2);
+}
+
+bool output_fits(const ScaledPolynomial& poly, int64_t x_limit, int64_t t) {
+    for (int64_t x = -x_limit; x <= x_limit; x++) {
+        if (!output_in_range(poly, x, t)) return false;
+    }
+    return true;
+}
+
+uint32_t required_depth(size_t degree) {
+    return power_depth_of(degree) + 1;
+}
+
+size_t tower_count(const ConstCiphertext<DCRTPoly>& ct) {
+    return ct->GetElements()[0].GetNumOfElements();
+}
+
+size_t min_decrypt_towers(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct) {
+    const double t_bits = std::log2(static_cast<double>(cc->GetEncodingParams()->GetPlaintextModulus()));
+    const double components = static_cast<double>(ct->GetElements().size());
+    const double needed_bits = t_bits + (components - 1.0) * std::log2(static_cast<double>(cc->GetRingDimension())) + 2.0;
+
+    const auto& towers = ct->GetElements()[0].GetParams()->GetParams();
+    double bits = 0.0;
+    for (size_t i = 0; i < towers.size(); i++) {
+        bits += towers[i]->GetModulus().GetMSB();
+        if (bits > needed_bits) return i + 1;
+    }
+    return towers.size();
+}
+
+Ciphertext<DCRTPoly> compact_ciphertext(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct) {
+    const size_t towers = min_decrypt_towers(cc, ct);
+    if (tower_count(ct) <= towers && ct->GetNoiseScaleDeg() == 1) return ct;
+    TraceScope scope("Compress");
+    return cc->Compress(ct, static_cast<uint32_t>(towers));
+}
+
+PolyEvalStats plan_poly_eval(const ScaledPolynomial& poly, bool lazy_relin) {
+    return plan_poly_eval_many({poly}, lazy_relin);
+}
+
+PolyEvalStats plan_poly_eval_many(const std::vector<ScaledPolynomial>& polys, bool lazy_relin) {
+    PolyEvalStats stats;
+    std::set<size_t> powers = {1};
+    std::set<size_t> factors;
+    for (const auto& poly : polys) {
+        size_t terms = 0;
+        for (size_t k = 1; k < poly.coeffs.size(); k++) {
+            if (poly.coeffs[k] == 0) continue;
+            plan_power(k, powers, stats, factors);
+            terms++;
+        }
+        stats.pt_mults += std::max<size_t>(terms, 1);
+        stats.additions += terms > 0 ? terms - 1 : 0;
+        if (!poly.coeffs.empty() && poly.coeffs[0] != 0) stats.additions++;
+    }
+    // 지연 재선형화: 인수로 쓰이는 거듭제곱마다 1회 + 잎 거듭제곱 항이 있는 출력마다 합계에 1회
+    const size_t relinearized = factors.size() - (factors.count(1) ? 1 : 0);
+    size_t leaf_outputs = 0;
+    for (const auto& poly : polys) {
+        for (size_t k = 2; k < poly.coeffs.size(); k++) {
+            if (poly.coeffs[k] != 0 && !factors.count(k)) {
+                leaf_outputs++;
+                break;
+            }
+        }
+    }
+    stats.key_switches = lazy_relin ? relinearized + leaf_outputs : stats.ct_mults;
+    return stats;
+}
+
+PolyEvaluator::PolyEvaluator(CryptoContext<DCRTPoly> cc, std::shared_ptr<CoeffStore> coeffs)
+    : m_cc(std::move(cc)), m_coeffs(coeffs ? std::move(coeffs) : std::make_shared<CoeffStore>(m_cc)) {}
+
+const Ciphertext<DCRTPoly>& PolyEvaluator::power(size_t k) {
+    auto it = m_powers.find(k);
+    if (it != m_powers.end()) return it->second;
+
+    const size_t best_a = choose_split(k, [this](size_t j) { return m_powers.count(j) > 0; });
+    const auto& ct_a = power(best_a);
+    const auto& ct_b = power(k - best_a);
+    Ciphertext<DCRTPoly> ct_k;
+    if (m_lazy_relin && !m_factors.count(k)) {
+        ct_k = traced_eval_mult_no_relin(m_cc, ct_a, ct_b);  // 잎: 3성분 그대로 두고 합계에서 한 번에 재선형화
+    } else {
+        ct_k = traced_eval_mult(m_cc, ct_a, ct_b);
+        m_stats.key_switches++;
+    }
+    m_stats.ct_mults++;
+    m_stats.power_depth = std::max(m_stats.power_depth, power_depth_of(k));
+    return m_powers.emplace(k, ct_k).first->second;
+}
+
+Ciphertext<DCRTPoly> PolyEvaluator::evaluate(const Ciphertext<DCRTPoly>& ct_x, const ScaledPolynomial& poly) {
+    return evaluate_many(ct_x, {poly}).front();
+}
+
+std::vector<Ciphertext<DCRTPoly>> PolyEvaluator::evaluate_many(const Ciphertext<DCRTPoly>& ct_x,
+                                                               const std::vector<ScaledPolynomial>& polys) {
+    m_stats = PolyEvalStats();
+    m_powers.clear();
+    m_powers.emplace(1, ct_x);
+
+    // combine 과 같은 순서로 거듭제곱 분할을 미리 계산해 (모든 다항식을 통틀어) 인수로 쓰이는 거듭제곱을 찾는다
+    m_factors.clear();
+    {
+        std::set<size_t> planned = {1};
+        PolyEvalStats unused;
+        for (const auto& poly : polys) {
+            for (size_t k = 1; k < poly.coeffs.size(); k++) {
+                if (poly.coeffs[k] != 0) plan_power(k, planned, unused, m_factors);
+            }
+        }
+    }
+
+    std::vector<Ciphertext<DCRTPoly>> results;
+    results.reserve(polys.size());
+    for (const auto& poly : polys) results.push_back(combine(ct_x, poly));
+
+    m_powers.clear();
+    return results;
+}
+
+Ciphertext<DCRTPoly> PolyEvaluator::combine(const Ciphertext<DCRTPoly>& ct_x, const ScaledPolynomial& poly) {
+    // (레벨, noise scale degree) 가 같은 항끼리 먼저 더한다 (레벨 맞춤 없이 바로 EvalAdd)
+    std::map<std::pair<size_t, size_t>, Ciphertext<DCRTPoly>> by_level;
+    for (size_t k = 1; k < poly.coeffs.size(); k++) {
+        if (poly.coeffs[k] == 0) continue;
+        const auto& ct_power = power(k);
+        auto term = traced_eval_mult(m_cc, ct_power, m_coeffs->scalar(poly.coeffs[k], ct_power));
+        m_stats.pt_mults++;
+        auto key = std::make_pair(term->GetLevel(), term->GetNoiseScaleDeg());
+        auto it = by_level.find(key);
+        if (it == by_level.end()) {
+            by_level.emplace(key, term);
+        } else {
+            it->second = traced_eval_add(m_cc, it->second, term);
+            m_stats.additions++;
+        }
+    }
+
+    // 낮은 레벨(타워가 많은)부터 합쳐, 누적값만 다음 레벨로 한 번씩 맞춰지게 한다
+    Ciphertext<DCRTPoly> result;
+    for (const auto& group : by_level) {
+        if (!result) {
+            result = group.second;
+        } else {
+            result = traced_eval_add(m_cc, result, group.second);
+            m_stats.additions++;
+        }
+    }
+    m_stats.level_groups = std::max(m_stats.level_groups, by_level.size());
+
+    if (!result) {
+        // 상수 다항식: 0 을 곱해 같은 형태의 암호문을 만든 뒤 상수항을 더한다
+        result = traced_eval_mult(m_cc, ct_x, m_coeffs->scalar(0, ct_x));
+        m_stats.pt_mults++;
+    }
+    if (!poly.coeffs.empty() && poly.coeffs[0] != 0) {
+        result = traced_eval_add(m_cc, result, m_coeffs->scalar(poly.coeffs[0], result));
+        m_stats.additions++;
+    }
+
+    // 3성분 항이 섞인 합계는 모든 레벨을 합친 뒤(타워가 가장 적은 상태) 한 번만 재선형화
+    if (result->GetElements().size() > 2) {
+        result = traced_relinearize(m_cc, result);
+        m_stats.key_switches++;
+    }
+
+    m_stats.towers_before = std::max(m_stats.towers_before, tower_count(result));
+    if (m_compact) result = compact_ciphertext(m_cc, result);
+    m_stats.towers_after = std::max(m_stats.towers_after, tower_count(result));
+    return result;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "he_coeff_store.h"
+#include "he_common.h"
+
+#include <map>
+#include <set>
+
+// ====== 정수 스케일 다항식 ======
+// y_scaled = sum_k coeffs[k] * x_scaled^k,  y ≈ y_scaled / scale
+// 모든 항이 같은 스케일(denom * s^n)로 정렬되어 있어 암호공간에서 EvalAdd 로 바로 합산 가능
+struct ScaledPolynomial {
+    std::vector<int64_t> coeffs;  // coeffs[k] : x_scaled^k 의 정수 계수
+    double scale = 1.0;           // 역스케일링 분모
+    int64_t s = 1;                // 입력 스케일링 상수 (x_scaled = round(s * x))
+
+    size_t degree() const { return coeffs.empty() ? 0 : coeffs.size() - 1; }
+};
+
+// sin(x) 테일러 다항식 (홀수 차수만) 정수화: ic_k = round(c_k * denom * s^(n-k))
+// 짝수 차수는 한 차수 낮춰 쓰고, degree < 1 이면 std::invalid_argument
+ScaledPolynomial make_taylor_sin(size_t degree, int64_t s, int64_t denom);
+
+// cos(x) 테일러 다항식 (짝수 차수만) 정수화: ic_k = round(c_k * denom * s^(n-k)), 상수항 포함
+ScaledPolynomial make_taylor_cos(size_t degree, int64_t s, int64_t denom);
+
+// 평문 정수 파이프라인 (mod t, 128비트 중간값으로 오버플로우 없이 계산, centered 결과)
+int64_t eval_scaled_plain(const ScaledPolynomial& poly, int64_t x_scaled, int64_t t);
+
+// 입력 x_scaled 에서 정확한(mod 없는) y_scaled 가 (-t/2, t/2) 안에 들어가는지 확인
+bool output_in_range(const ScaledPolynomial& poly, int64_t x_scaled, int64_t t);
+
+// |x_scaled| <= x_limit 인 모든 정수 입력에서 정확한 y_scaled 가 (-t/2, t/2) 안에 들어가는지 확인
+bool output_fits(const ScaledPolynomial& poly, int64_t x_limit, int64_t t);
+
+// 차수 degree 다항식을 평가하는 데 필요한 곱셈 뎁스 (거듭제곱 트리 + 계수 평문 곱 1회)
+uint32_t required_depth(size_t degree);
+
+// ====== 암호공간 다항식 평가기 ======
+struct PolyEvalStats {
+    size_t ct_mults = 0;     // 암호문 x 암호문 곱셈 수
+    size_t pt_mults = 0;     // 암호문 x 평문 곱셈 수
+    size_t additions = 0;    // EvalAdd 수
+    uint32_t power_depth = 0; // 가장 높은 거듭제곱의 뎁스
+    size_t level_groups = 0;  // 항들의 서로 다른 레벨 수 (레벨 맞춤 = level_groups - 1 회)
+    size_t towers_before = 0; // 압축 전 결과 암호문의 RNS 타워 수
+    size_t towers_after = 0;  // 압축 후 (복호화/전송되는) 타워 수
+    size_t key_switches = 0;  // 재선형화(키 스위칭) 수
+};
+
+// ====== 레벨 / 타워 ======
+// 암호문의 RNS 타워 수
+size_t tower_count(const ConstCiphertext<DCRTPoly>& ct);
+
+// 복호화가 맞게 되는 최소 타워 수: 남은 모듈러스가 t * N^(성분 수 - 1) * 4 보다 커야 한다
+// (모듈러스 스위칭 반올림 잡음 t * |δ_i·s^i| <= t * N^i / 2 의 여유, 재선형화 전 3성분 암호문은 s^2 항까지)
+size_t min_decrypt_towers(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct);
+
+// 복호화/직렬화 직전 암호문을 최소 타워 수로 모듈러스 스위칭 (Compress). 이미 작으면 그대로 반환
+Ciphertext<DCRTPoly> compact_ciphertext(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct);
+
+// 암호문 없이 PolyEvaluator::evaluate 와 같은 거듭제곱 분할로 연산 수만 계산 (파라미터 비용 추정용)
+PolyEvalStats plan_poly_eval(const ScaledPolynomial& poly, bool lazy_relin = true);
+
+// PolyEvaluator::evaluate_many 와 같은 순서로 여러 다항식이 거듭제곱을 공유할 때의 연산 수
+PolyEvalStats plan_poly_eval_many(const std::vector<ScaledPolynomial>& polys, bool lazy_relin = true);
+
+class PolyEvaluator {
+public:
+    // coeffs 를 넘기면 여러 평가기가 같은 계수 평문 캐시를 공유 (nullptr 이면 자체 캐시 생성)
+    explicit PolyEvaluator(CryptoContext<DCRTPoly> cc, std::shared_ptr<CoeffStore> coeffs = nullptr);
+
+    // ct_x 에 대해 poly 를 평가해 하나의 암호문으로 반환 (복호화 1회로 y_scaled 획득)
+    // 같은 레벨의 항끼리 먼저 더한 뒤 레벨 순으로 합치고, 압축이 켜져 있으면 결과를 최소 타워 수로 줄인다
+    Ciphertext<DCRTPoly> evaluate(const Ciphertext<DCRTPoly>& ct_x, const ScaledPolynomial& poly);
+
+    // 같은 입력에 여러 다항식 (예: sin, cos) 을 평가: 거듭제곱 x^2, x^3, ... 은 한 번만 만들고
+    // 각 다항식은 필요한 짝수/홀수 거듭제곱을 공유해 계수 곱과 합산만 따로 한다 (다항식마다 결과 암호문 하나)
+    std::vector<Ciphertext<DCRTPoly>> evaluate_many(const Ciphertext<DCRTPoly>& ct_x,
+                                                    const std::vector<ScaledPolynomial>& polys);
+
+    // 결과 압축 여부 (기본 켜짐, 결과로 계속 연산할 때는 끈다)
+    void set_compaction(bool enabled) { m_compact = enabled; }
+
+    // 지연 재선형화 (기본 켜짐): 다른 거듭제곱의 인수로 쓰이지 않는 거듭제곱(잎)은 EvalMultNoRelin 으로 만들어
+    // 3성분 그대로 계수를 곱하고 더한 뒤, 합계에 Relinearize 를 한 번만 적용한다
+    void set_lazy_relin(bool enabled) { m_lazy_relin = enabled; }
+
+    // 직전 evaluate / evaluate_many 호출의 연산 통계 (evaluate_many 는 모든 출력 합계, 타워 수는 최댓값)
+    const PolyEvalStats& stats() const { return m_stats; }
+
+    const std::shared_ptr<CoeffStore>& coeffs() const { return m_coeffs; }
+
+private:
+    // 뎁스 ceil(log2 k) 를 유지하면서 이미 계산된 거듭제곱을 최대한 재사용해 x^k 계산
+    const Ciphertext<DCRTPoly>& power(size_t k);
+
+    // 준비된 거듭제곱으로 poly 의 항을 곱해 합산하고 (필요하면 재선형화 / 압축) 결과 하나를 만든다
+    Ciphertext<DCRTPoly> combine(const Ciphertext<DCRTPoly>& ct_x, const ScaledPolynomial& poly);
+
+    CryptoContext<DCRTPoly> m_cc;
+    std::shared_ptr<CoeffStore> m_coeffs;
+    std::map<size_t, Ciphertext<DCRTPoly>> m_powers;
+    std::set<size_t> m_factors;  // 다른 거듭제곱의 인수로 쓰이는 거듭제곱 (재선형화 필요)
+    PolyEvalStats m_stats;
+    bool m_compact = true;
+    bool m_lazy_relin = true;
+};
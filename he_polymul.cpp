@@ -0,0 +1,61 @@
+#include "he_polymul.h"
+
+#include <stdexcept>
+
+Ciphertext<DCRTPoly> encrypt_coeffs(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                    const std::vector<int64_t>& coeffs) {
+    if (coeffs.size() > cc->GetRingDimension()) throw std::invalid_argument("계수 개수가 링 차원보다 큽니다");
+    return cc->Encrypt(publicKey, cc->MakeCoefPackedPlaintext(coeffs));
+}
+
+std::vector<int64_t> decrypt_coeffs(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                                    const Ciphertext<DCRTPoly>& ct, size_t count) {
+    const int64_t t = static_cast<int64_t>(cc->GetEncodingParams()->GetPlaintextModulus());
+    Plaintext p;
+    cc->Decrypt(secretKey, ct, &p);
+    p->SetLength(count);
+    std::vector<int64_t> coeffs(count);
+    for (size_t k = 0; k < count; k++) coeffs[k] = centered_mod(p->GetCoefPackedValue()[k], t);
+    return coeffs;
+}
+
+Ciphertext<DCRTPoly> multiply_polys(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct_a,
+                                    const Ciphertext<DCRTPoly>& ct_b) {
+    return cc->EvalMult(ct_a, ct_b);
+}
+
+Ciphertext<DCRTPoly> multiply_polys(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct_a,
+                                    const std::vector<int64_t>& b) {
+    return cc->EvalMult(ct_a, cc->MakeCoefPackedPlaintext(b));
+}
+
+std::vector<Ciphertext<DCRTPoly>> encrypt_terms(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                                const std::vector<int64_t>& coeffs) {
+    std::vector<Ciphertext<DCRTPoly>> terms;
+    terms.reserve(coeffs.size());
+    for (int64_t c : coeffs) terms.push_back(cc->Encrypt(publicKey, cc->MakePackedPlaintext({c})));
+    return terms;
+}
+
+std::vector<Ciphertext<DCRTPoly>> multiply_term_by_term(const CryptoContext<DCRTPoly>& cc,
+                                                        const std::vector<Ciphertext<DCRTPoly>>& ct_a,
+                                                        const std::vector<Ciphertext<DCRTPoly>>& ct_b) {
+    if (ct_a.empty() || ct_b.empty()) return {};
+    std::vector<Ciphertext<DCRTPoly>> terms(ct_a.size() + ct_b.size() - 1);
+    for (size_t i = 0; i < ct_a.size(); i++) {
+        for (size_t j = 0; j < ct_b.size(); j++) {
+            auto product = cc->EvalMult(ct_a[i], ct_b[j]);
+            auto& term = terms[i + j];
+            term = term ? cc->EvalAdd(term, product) : product;
+        }
+    }
+    return terms;
+}
+
+std::vector<int64_t> decrypt_terms(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                                   const std::vector<Ciphertext<DCRTPoly>>& terms) {
+    std::vector<int64_t> values;
+    values.reserve(terms.size());
+    for (const auto& term : terms) values.push_back(decrypt_batch(cc, secretKey, {term}, 1)[0]);
+    return values;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_ntt.h"
+
+// ====== 암호화된 다항식 곱셈 ======
+// 계수 인코딩(MakeCoefPackedPlaintext): 다항식 계수를 평문 다항식 계수에 그대로 넣으면
+// 암호문 곱셈 한 번이 Z_t[X] / (X^N + 1) 의 다항식 곱(negacyclic convolution)이 된다.
+// 차수 합이 N 보다 작으면 (deg a + deg b < N) 일반 다항식 곱과 같다.
+// 평문 기준 곱 negacyclic_multiply / ntt_multiply 는 he_ntt.h (OpenFHE 불필요).
+
+// 계수 벡터(길이 <= N)를 계수 인코딩으로 암호화
+Ciphertext<DCRTPoly> encrypt_coeffs(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                    const std::vector<int64_t>& coeffs);
+
+// 앞에서부터 count 개 계수를 centered 형태로 복호화
+std::vector<int64_t> decrypt_coeffs(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                                    const Ciphertext<DCRTPoly>& ct, size_t count);
+
+// 암호문 x 암호문 다항식 곱 (EvalMult 1회)
+Ciphertext<DCRTPoly> multiply_polys(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct_a,
+                                    const Ciphertext<DCRTPoly>& ct_b);
+
+// 암호문 x 평문 다항식 곱 (키 스위칭 없음)
+Ciphertext<DCRTPoly> multiply_polys(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& ct_a,
+                                    const std::vector<int64_t>& b);
+
+// ====== 비교 기준: 항별 곱셈 ======
+// 계수마다 암호문 하나 (슬롯 0) 로 두고 c_k = sum_{i+j=k} a_i * b_j 를 EvalMult n_a * n_b 회로 계산
+std::vector<Ciphertext<DCRTPoly>> encrypt_terms(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                                const std::vector<int64_t>& coeffs);
+
+std::vector<Ciphertext<DCRTPoly>> multiply_term_by_term(const CryptoContext<DCRTPoly>& cc,
+                                                        const std::vector<Ciphertext<DCRTPoly>>& ct_a,
+                                                        const std::vector<Ciphertext<DCRTPoly>>& ct_b);
+
+std::vector<int64_t> decrypt_terms(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                                   const std::vector<Ciphertext<DCRTPoly>>& terms);
@@ -0,0 +1,338 @@
+#include "he_service.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "he_pipeline.h"
+
+namespace {
+
+const size_t kFrameHeaderBytes = 16;
+
+std::string encode_poly(const ScaledPolynomial& poly) {
+    std::ostringstream os;
+    os << std::setprecision(17) << poly.s << " " << poly.scale << " " << poly.coeffs.size();
+    for (int64_t c : poly.coeffs) os << " " << c;
+    return os.str();
+}
+
+ScaledPolynomial decode_poly(const std::vector<char>& payload) {
+    std::istringstream is(std::string(payload.begin(), payload.end()));
+    ScaledPolynomial poly;
+    size_t count = 0;
+    is >> poly.s >> poly.scale >> count;
+    poly.coeffs.resize(count);
+    for (auto& c : poly.coeffs) is >> c;
+    if (!is) throw std::runtime_error("서버 파라미터 프레임을 해석할 수 없습니다");
+    return poly;
+}
+
+template <typename Header>
+Header read_header(const std::vector<char>& payload) {
+    if (payload.size() < sizeof(Header)) throw std::runtime_error("프레임이 너무 짧습니다");
+    Header header;
+    std::memcpy(&header, payload.data(), sizeof(Header));
+    return header;
+}
+
+}  // namespace
+
+ServiceSetup make_service_setup(size_t degree) {
+    const int64_t s = 50;
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+
+    ServiceSetup setup;
+    setup.poly = make_taylor_sin(degree, s, denom);
+    setup.parameters.SetPlaintextModulus(593779228673);
+    setup.parameters.SetMultiplicativeDepth(required_depth(setup.poly.degree()));
+    setup.parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    setup.parameters.SetRingDim(16384);
+    return setup;
+}
+
+// ====== 서버 ======
+SinServer::SinServer(HeContext he, ScaledPolynomial poly)
+    : m_he(std::move(he)), m_poly(std::move(poly)), m_coeffs(std::make_shared<CoeffStore>(m_he.cc)) {}
+
+SinServer::~SinServer() {
+    stop();
+    // 연결 스레드는 끝날 때 m_mutex 를 잡으므로 목록만 옮기고 락 밖에서 join
+    std::list<Connection> remaining;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        remaining.splice(remaining.end(), m_active);
+    }
+    for (auto& connection : remaining) {
+        if (connection.thread.joinable()) connection.thread.join();
+    }
+}
+
+void SinServer::serve(const std::string& socket_path) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_listen_fd = listen_unix(socket_path);
+    }
+    std::cout << "대기 중: " << socket_path << std::endl;
+    while (!m_stopping) {
+        int fd = ::accept(m_listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            const int error = errno;
+            if (m_stopping || error == EINTR || error == ECONNABORTED) continue;
+            if (error == EMFILE || error == ENFILE || error == ENOBUFS || error == ENOMEM) {
+                // fd / 메모리 고갈: 바로 다시 accept 하면 같은 오류로 바쁘게 돈다. 끝난 연결을 정리하고 잠시 기다린다
+                std::cerr << "accept 실패: " << std::strerror(error) << ", 잠시 후 다시 시도" << std::endl;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    reap_finished();
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            // 그 밖의 오류는 리슨 소켓 자체의 문제: 열린 연결을 끊고 종료
+            std::cerr << "accept 실패: " << std::strerror(error) << ", 서버를 멈춥니다" << std::endl;
+            stop();
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        reap_finished();
+        if (m_stopping) {
+            ::close(fd);
+            break;
+        }
+        m_active.emplace_back();
+        auto it = std::prev(m_active.end());
+        it->fd = fd;
+        it->thread = std::thread([this, it] {
+            handle_connection(it->fd);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ::close(it->fd);
+            it->fd = -1;
+            it->done = true;
+        });
+    }
+
+    // stop() 이 열린 연결을 모두 끊었으므로 스레드는 곧 끝난다
+    std::list<Connection> remaining;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        remaining.splice(remaining.end(), m_active);
+        ::close(m_listen_fd);
+        m_listen_fd = -1;
+    }
+    for (auto& connection : remaining) connection.thread.join();
+    std::cout << "서버 종료" << std::endl;
+}
+
+void SinServer::stop() {
+    m_stopping = true;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // shutdown 으로 accept / recv 에서 막힌 스레드를 깨운다 (fd 는 각 소유자가 닫는다)
+    if (m_listen_fd >= 0) ::shutdown(m_listen_fd, SHUT_RDWR);
+    for (auto& connection : m_active) {
+        if (connection.fd >= 0) ::shutdown(connection.fd, SHUT_RDWR);
+    }
+}
+
+void SinServer::reap_finished() {
+    for (auto it = m_active.begin(); it != m_active.end();) {
+        if (it->done) {
+            it->thread.join();
+            it = m_active.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void SinServer::handle_connection(int fd) {
+    const size_t id = ++m_connections;
+    PolyEvaluator evaluator(m_he.cc, m_coeffs);
+    std::vector<char> request;  // 수신 버퍼 (요청마다 재사용)
+    std::vector<char> result;   // 직렬화 버퍼 (요청마다 재사용)
+    size_t served = 0;
+    double eval_total_ms = 0.0;
+
+    const std::string params = encode_poly(m_poly);
+    bool ok = send_frame(fd, FrameType::Params, nullptr, 0, params.data(), params.size());
+
+    FrameType type;
+    while (ok && recv_frame(fd, type, request)) {
+        if (type == FrameType::Bye) break;
+        if (type != FrameType::Request) continue;
+
+        ResultHeader header;
+        try {
+            header.request_id = read_header<RequestHeader>(request).request_id;
+
+            auto start = Clock::now();
+            auto ct_x = deserialize_ciphertext(request.data() + sizeof(RequestHeader), request.size() - sizeof(RequestHeader));
+            header.deserialize_ms = elapsed_ms(start, Clock::now());
+
+            start = Clock::now();
+            auto ct_y = evaluator.evaluate(ct_x, m_poly);
+            header.eval_ms = elapsed_ms(start, Clock::now());
+
+            start = Clock::now();
+            serialize_ciphertext(ct_y, result);
+            header.serialize_ms = elapsed_ms(start, Clock::now());
+        } catch (const std::exception& e) {
+            const std::string message = e.what();
+            ok = send_frame(fd, FrameType::Error, nullptr, 0, message.data(), message.size());
+            continue;
+        }
+
+        ok = send_frame(fd, FrameType::Result, &header, sizeof(header), result.data(), result.size());
+        served++;
+        eval_total_ms += header.eval_ms;
+    }
+
+    std::cout << "연결 " << id << " 종료: 요청 " << served << "개";
+    if (served > 0) std::cout << ", 평균 평가 " << std::fixed << std::setprecision(2) << eval_total_ms / served << " ms";
+    std::cout << std::endl;
+}
+
+// ====== 클라이언트 ======
+SinClient::SinClient(const std::string& socket_path) : m_fd(connect_unix(socket_path)) {
+    FrameType type;
+    if (!recv_frame(m_fd, type, m_recv_buffer) || type != FrameType::Params) {
+        ::close(m_fd);
+        throw std::runtime_error("서버 파라미터를 받지 못했습니다");
+    }
+    m_poly = decode_poly(m_recv_buffer);
+}
+
+SinClient::~SinClient() {
+    send_frame(m_fd, FrameType::Bye, nullptr, 0, nullptr, 0);
+    ::close(m_fd);
+}
+
+Ciphertext<DCRTPoly> SinClient::evaluate(const Ciphertext<DCRTPoly>& ct_x) {
+    ClientReport report;
+    return evaluate_many({ct_x}, 1, report).front();
+}
+
+std::vector<Ciphertext<DCRTPoly>> SinClient::evaluate_many(const std::vector<Ciphertext<DCRTPoly>>& inputs,
+                                                           size_t inflight, ClientReport& report) {
+    const size_t n = inputs.size();
+    const uint64_t first_id = m_next_id;
+    m_next_id += n;
+    inflight = std::max<size_t>(1, inflight);
+
+    std::vector<Ciphertext<DCRTPoly>> outputs(n);
+    std::vector<Clock::time_point> sent_at(n);
+    std::vector<double> latencies;
+    latencies.reserve(n);
+
+    std::mutex mutex;
+    std::condition_variable window;
+    size_t pending = 0;
+    std::string error;
+
+    double serialize_ms = 0.0;
+    double deserialize_ms = 0.0;
+    double server_deserialize_ms = 0.0;
+    double server_eval_ms = 0.0;
+    double server_serialize_ms = 0.0;
+    size_t sent_bytes = 0;
+    size_t received_bytes = 0;
+
+    auto wall_start = Clock::now();
+
+    // 수신 스레드: 결과를 받는 대로 역직렬화하고 송신 창을 하나 연다.
+    // 송신과 수신을 분리해야 큰 암호문이 양쪽 소켓 버퍼를 채워도 서로 막히지 않는다.
+    std::thread receiver([&] {
+        FrameType type = FrameType::Bye;
+        for (size_t received = 0; received < n; received++) {
+            if (!recv_frame(m_fd, type, m_recv_buffer) || type != FrameType::Result) {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = type == FrameType::Error ? std::string(m_recv_buffer.begin(), m_recv_buffer.end())
+                                                 : std::string("서버 연결이 끊어졌습니다");
+                window.notify_all();
+                return;
+            }
+            ResultHeader header;
+            if (m_recv_buffer.size() >= sizeof(ResultHeader)) header = read_header<ResultHeader>(m_recv_buffer);
+            const uint64_t index = header.request_id - first_id;
+            if (m_recv_buffer.size() < sizeof(ResultHeader) || header.request_id < first_id || index >= n
+                || outputs[index]) {
+                // 이번 호출에서 보낸 적 없는 id 이거나 이미 받은 결과 (오래된 응답, 서버 오류)
+                std::lock_guard<std::mutex> lock(mutex);
+                error = "잘못된 결과 요청 id: " + std::to_string(header.request_id);
+                window.notify_all();
+                return;
+            }
+
+            auto start = Clock::now();
+            outputs[index] = deserialize_ciphertext(m_recv_buffer.data() + sizeof(ResultHeader),
+                                                    m_recv_buffer.size() - sizeof(ResultHeader));
+            auto end = Clock::now();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            deserialize_ms += elapsed_ms(start, end);
+            server_deserialize_ms += header.deserialize_ms;
+            server_eval_ms += header.eval_ms;
+            server_serialize_ms += header.serialize_ms;
+            received_bytes += kFrameHeaderBytes + m_recv_buffer.size();
+            latencies.push_back(elapsed_ms(sent_at[index], end));
+            pending--;
+            window.notify_all();
+        }
+    });
+
+    for (size_t i = 0; i < n; i++) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            window.wait(lock, [&] { return !error.empty() || pending < inflight; });
+            if (!error.empty()) break;
+            pending++;
+            sent_at[i] = Clock::now();
+        }
+
+        auto start = Clock::now();
+        serialize_ciphertext(inputs[i], m_send_buffer);
+        double ms = elapsed_ms(start, Clock::now());
+
+        RequestHeader header;
+        header.request_id = first_id + i;
+        bool ok = send_frame(m_fd, FrameType::Request, &header, sizeof(header), m_send_buffer.data(), m_send_buffer.size());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        serialize_ms += ms;
+        sent_bytes += kFrameHeaderBytes + sizeof(header) + m_send_buffer.size();
+        if (!ok && error.empty()) error = "요청 전송 실패";
+    }
+    if (!error.empty()) ::shutdown(m_fd, SHUT_RDWR);  // 수신 스레드 깨우기
+    receiver.join();
+    if (!error.empty()) throw std::runtime_error(error);
+
+    report.requests = n;
+    report.wall_ms = elapsed_ms(wall_start, Clock::now());
+    report.requests_per_sec = report.wall_ms > 0.0 ? n * 1000.0 / report.wall_ms : 0.0;
+    if (n > 0) {
+        report.request_bytes = static_cast<double>(sent_bytes) / n;
+        report.result_bytes = static_cast<double>(received_bytes) / n;
+        report.client_serialize_ms = serialize_ms / n;
+        report.client_deserialize_ms = deserialize_ms / n;
+        report.server_deserialize_ms = server_deserialize_ms / n;
+        report.server_eval_ms = server_eval_ms / n;
+        report.server_serialize_ms = server_serialize_ms / n;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    report.latency_p50_ms = percentile(latencies, 50.0);
+    report.latency_p99_ms = percentile(latencies, 99.0);
+    return outputs;
+}
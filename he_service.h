@@ -0,0 +1,106 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+#include "he_wire.h"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// ====== sin 평가 서비스 (클라이언트 / 서버 분리) ======
+// 서버: 캐시 디렉토리에서 컨텍스트, 공개키, eval 키만 로드한다 (비밀키 없음).
+//       Unix 소켓으로 받은 암호문에 다항식을 평가하고, 압축된 결과 암호문을 요청 순서대로 돌려준다.
+// 클라이언트: 전체 키로 암호화/복호화하고, 요청을 inflight 개까지 겹쳐 보낸다 (송신 스레드 + 수신 스레드).
+// 연결 직후 서버가 Params 프레임으로 다항식(s, scale, 계수)을 알려주고, 클라이언트는 자기 설정과 같은지 확인한다.
+
+struct ServiceSetup {
+    ScaledPolynomial poly;
+    CCParams<CryptoContextBGVRNS> parameters;
+};
+
+// sin_client --setup 이 비밀키 없이 내보내는 서버용 키 디렉토리 (sin_server --keys 기본값)
+const char* const kServerKeysDir = "server_keys";
+
+// 서버와 클라이언트가 같은 캐시 디렉토리를 찾도록 같은 방식으로 만드는 파라미터 (sin_pipeline 과 동일: s = 50, denom = n!)
+ServiceSetup make_service_setup(size_t degree);
+
+class SinServer {
+public:
+    SinServer(HeContext he, ScaledPolynomial poly);
+
+    ~SinServer();
+
+    // socket_path 에서 연결을 받아 연결마다 스레드 하나로 처리. stop() 이 불리면 모든 연결 스레드를 join 하고 반환
+    void serve(const std::string& socket_path);
+
+    // 다른 스레드에서 호출: 새 연결을 그만 받고 열린 연결을 끊는다 (serve 가 정리 후 반환)
+    void stop();
+
+    // 연결 하나 처리: Params 전송 후 Bye 또는 연결 종료까지 요청 처리 (fd 는 호출한 쪽이 닫음)
+    void handle_connection(int fd);
+
+private:
+    struct Connection {
+        int fd = -1;
+        bool done = false;   // handle_connection 이 끝나 join 만 남음
+        std::thread thread;
+    };
+
+    // 끝난 연결 스레드 join (m_mutex 를 잡은 상태에서 호출)
+    void reap_finished();
+
+    HeContext m_he;
+    ScaledPolynomial m_poly;
+    std::shared_ptr<CoeffStore> m_coeffs;  // 연결 사이에 공유하는 계수 평문 캐시
+    std::atomic<size_t> m_connections{0};
+
+    std::atomic<bool> m_stopping{false};
+    int m_listen_fd = -1;
+    std::mutex m_mutex;
+    std::list<Connection> m_active;
+};
+
+struct ClientReport {
+    size_t requests = 0;
+    double wall_ms = 0.0;
+    double requests_per_sec = 0.0;
+    double request_bytes = 0.0;          // 요청당 평균 전송 바이트 (프레임 헤더 포함)
+    double result_bytes = 0.0;           // 요청당 평균 수신 바이트 (프레임 헤더 포함)
+    double client_serialize_ms = 0.0;    // 요청당 평균 (클라이언트 측)
+    double client_deserialize_ms = 0.0;
+    double server_deserialize_ms = 0.0;  // 요청당 평균 (서버가 ResultHeader 로 보고)
+    double server_eval_ms = 0.0;
+    double server_serialize_ms = 0.0;
+    double latency_p50_ms = 0.0;         // 송신 시작부터 결과 역직렬화 끝까지
+    double latency_p99_ms = 0.0;
+};
+
+class SinClient {
+public:
+    explicit SinClient(const std::string& socket_path);
+    ~SinClient();
+    SinClient(const SinClient&) = delete;
+    SinClient& operator=(const SinClient&) = delete;
+
+    // 서버가 평가하는 다항식
+    const ScaledPolynomial& poly() const { return m_poly; }
+
+    // 요청 하나를 보내고 결과를 기다림
+    Ciphertext<DCRTPoly> evaluate(const Ciphertext<DCRTPoly>& ct_x);
+
+    // 요청들을 최대 inflight 개까지 겹쳐 보내고 결과를 입력 순서대로 반환
+    std::vector<Ciphertext<DCRTPoly>> evaluate_many(const std::vector<Ciphertext<DCRTPoly>>& inputs, size_t inflight,
+                                                    ClientReport& report);
+
+private:
+    int m_fd = -1;
+    uint64_t m_next_id = 0;
+    ScaledPolynomial m_poly;
+    std::vector<char> m_send_buffer;  // 요청마다 재사용하는 직렬화 버퍼
+    std::vector<char> m_recv_buffer;  // 요청마다 재사용하는 수신 버퍼
+};
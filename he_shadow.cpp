@@ -0,0 +1,118 @@
+#include "he_shadow.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "he_modmath.h"
+
+namespace {
+
+// shadow_lanes 가 붙이는 내부 플래그: 출력 상한이 t/2 에 닿을 수 있어 128비트 경로로 다시 판정
+constexpr uint8_t kNeedsExact = 0x80;
+
+// 입력 블록을 레인에 나눠 계수 순으로 훑는다: 2^64 wraparound Horner (|정확한 값| < 2^63 이면 그대로 정확한 값),
+// |c_k| |x|^k 의 합(출력 상한)과 최대값(가장 넓은 항)을 double 로 계산해 플래그로 바꾼다.
+// target_clones 로 AVX-512 / AVX2 / 기본 버전을 만들고 실행 시 CPU 에 맞는 것을 고른다.
+__attribute__((target_clones("arch=skylake-avx512", "arch=haswell", "default")))
+void shadow_lanes(const int64_t* coeffs, const double* abs_coeffs, size_t terms, const int64_t* x, size_t count,
+                  double half_t, double safe_limit, int64_t* wrapped, uint8_t* flags) {
+    constexpr size_t kBlock = 512;
+    uint64_t acc[kBlock];
+    double ax[kBlock], sum[kBlock], power[kBlock], top[kBlock];
+    for (size_t base = 0; base < count; base += kBlock) {
+        const size_t n = std::min(kBlock, count - base);
+        const int64_t* xb = x + base;
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+            acc[i] = 0;
+            sum[i] = 0.0;
+            ax[i] = std::fabs(static_cast<double>(xb[i]));
+        }
+        for (size_t k = terms; k-- > 0;) {
+            const uint64_t c = static_cast<uint64_t>(coeffs[k]);
+            const double abs_c = abs_coeffs[k];
+#pragma omp simd
+            for (size_t i = 0; i < n; i++) {
+                acc[i] = acc[i] * static_cast<uint64_t>(xb[i]) + c;
+                sum[i] = sum[i] * ax[i] + abs_c;
+            }
+        }
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+            power[i] = 1.0;
+            top[i] = 0.0;
+        }
+        for (size_t k = 0; k < terms; k++) {
+            const double abs_c = abs_coeffs[k];
+#pragma omp simd
+            for (size_t i = 0; i < n; i++) {
+                const double term = abs_c * power[i];
+                top[i] = term > top[i] ? term : top[i];
+                power[i] *= ax[i];
+            }
+        }
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+            wrapped[base + i] = static_cast<int64_t>(acc[i]);
+            flags[base + i] = (top[i] >= half_t ? ShadowTermWide : 0) | (sum[i] >= safe_limit ? kNeedsExact : 0);
+        }
+    }
+}
+
+// 128비트 Horner, 중간값이 넘치면 false (그만큼 큰 입력은 범위 밖으로 본다)
+bool exact_value(const ScaledPolynomial& poly, int64_t x, int128_t& value) {
+    int128_t acc = 0;
+    for (size_t k = poly.coeffs.size(); k-- > 0;) {
+        if (__builtin_mul_overflow(acc, static_cast<int128_t>(x), &acc)) return false;
+        if (__builtin_add_overflow(acc, static_cast<int128_t>(poly.coeffs[k]), &acc)) return false;
+    }
+    value = acc;
+    return true;
+}
+
+}  // namespace
+
+ShadowBatch shadow_evaluate(const ScaledPolynomial& poly, const std::vector<int64_t>& x_scaled, int64_t t) {
+    auto start = Clock::now();
+    const size_t count = x_scaled.size();
+    const int64_t half_t = t / 2;
+
+    ShadowBatch batch;
+    batch.expected.resize(count);
+    batch.flags.resize(count);
+
+    std::vector<double> abs_coeffs(poly.coeffs.size());
+    for (size_t k = 0; k < poly.coeffs.size(); k++) abs_coeffs[k] = std::fabs(static_cast<double>(poly.coeffs[k]));
+    // double 합의 반올림 오차(항 수 * 2^-53 정도)보다 넉넉한 여유를 두고, 상한이 t/2 에 닿을 수 있는 입력만 다시 계산
+    const double safe_limit = static_cast<double>(half_t) * (1.0 - 1e-12);
+    shadow_lanes(poly.coeffs.data(), abs_coeffs.data(), poly.coeffs.size(), x_scaled.data(), count,
+                 static_cast<double>(half_t), safe_limit, batch.expected.data(), batch.flags.data());
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t& flag = batch.flags[i];
+        if (flag == 0) continue;  // |정확한 값| < t/2: wraparound 값이 곧 centered 결과
+        if (flag & ShadowTermWide) batch.wide_terms++;
+        if (!(flag & kNeedsExact)) continue;
+
+        flag &= ~kNeedsExact;
+        batch.exact_fallbacks++;
+        int128_t value = 0;
+        const bool fits = exact_value(poly, x_scaled[i], value);
+        if (!fits || value >= half_t || value <= -half_t) {
+            flag |= ShadowOutputWrap;
+            batch.output_wraps++;
+        }
+        batch.expected[i] = eval_scaled_plain(poly, x_scaled[i], t);
+    }
+
+    batch.ms = elapsed_ms(start, Clock::now());
+    return batch;
+}
+
+std::vector<size_t> shadow_mismatches(const ShadowBatch& shadow, const std::vector<int64_t>& decrypted) {
+    std::vector<size_t> mismatches;
+    for (size_t i = 0; i < shadow.expected.size(); i++) {
+        if (i >= decrypted.size() || decrypted[i] != shadow.expected[i]) mismatches.push_back(i);
+    }
+    return mismatches;
+}
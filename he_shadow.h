@@ -0,0 +1,33 @@
+#pragma once
+
+#include "he_poly_eval.h"
+
+// ====== 그림자(shadow) 평가 ======
+// 암호문 연산을 예약하기 전에 같은 정수 다항식을 평문에서 입력마다 정확히 계산해
+// 1) 정확한 y_scaled 가 (-t/2, t/2) 밖으로 나가 복호화 값이 감기는(wraparound) 입력을 미리 거르고
+// 2) 복호화 결과를 한꺼번에 대조할 기대값(centered mod t)을 만든다.
+// 입력 여러 개를 SIMD 레인에 나눠 2^64 wraparound 정수 Horner 와 double 상한을 함께 계산하고,
+// 상한이 t/2 에 가까운 입력만 128비트 경로로 다시 판정한다.
+
+enum ShadowFlag : uint8_t {
+    ShadowOutputWrap = 1,  // 정확한 출력이 centered 범위 밖 (복호화 값이 감긴다, 배치 거부 대상)
+    ShadowTermWide = 2,    // 어떤 항 |c_k x^k| 가 t/2 이상 (mod t 에서는 무해하지만 합의 상쇄에 기대는 입력)
+};
+
+struct ShadowBatch {
+    std::vector<int64_t> expected;  // 입력별 y_scaled (centered mod t, 복호화 결과와 같아야 함)
+    std::vector<uint8_t> flags;     // 입력별 ShadowFlag 비트
+    size_t output_wraps = 0;        // ShadowOutputWrap 입력 수
+    size_t wide_terms = 0;          // ShadowTermWide 입력 수
+    size_t exact_fallbacks = 0;     // 128비트 경로로 다시 계산한 입력 수
+    double ms = 0.0;                // 그림자 평가 시간
+
+    // 감기는 입력이 없으면 암호문 연산을 진행해도 된다
+    bool ok() const { return output_wraps == 0; }
+};
+
+// x_scaled 전체를 그림자 평가 (t < 2^62)
+ShadowBatch shadow_evaluate(const ScaledPolynomial& poly, const std::vector<int64_t>& x_scaled, int64_t t);
+
+// 복호화 결과를 기대값과 대조해 다른 입력의 인덱스를 반환 (decrypted 가 짧으면 없는 부분은 불일치)
+std::vector<size_t> shadow_mismatches(const ShadowBatch& shadow, const std::vector<int64_t>& decrypted);
@@ -0,0 +1,120 @@
+#include "he_stream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "he_pipeline.h"
+
+std::vector<double> generate_random_walk(size_t n, uint32_t seed) {
+    const double x_min = -M_PI / 2;
+    const double x_max = M_PI / 2;
+    const double k_repulse = 0.5;
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> randn(0.0, 1.0);
+
+    std::vector<double> x(n, 0.0);
+    for (size_t k = 1; k < n; k++) {
+        double step = 0.05 * randn(rng);
+        if (x[k - 1] > x_max) {
+            step -= k_repulse * (x[k - 1] - x_max);
+        } else if (x[k - 1] < x_min) {
+            step += k_repulse * (x_min - x[k - 1]);
+        }
+        x[k] = x[k - 1] + step;
+    }
+    return x;
+}
+
+SinStreamProcessor::SinStreamProcessor(CryptoContext<DCRTPoly> cc, KeyPair<DCRTPoly> keyPair,
+                                       ScaledPolynomial poly, StreamConfig config, Sink sink)
+    : m_cc(std::move(cc)),
+      m_keyPair(std::move(keyPair)),
+      m_poly(std::move(poly)),
+      m_config(config),
+      m_sink(std::move(sink)),
+      m_evaluator(m_cc),
+      m_slots(slot_count(m_cc)) {}
+
+size_t SinStreamProcessor::window_size() const {
+    // (w - 1) / rate + 처리 시간 <= deadline
+    double budget_ms = m_config.deadline_ms - m_last_compute_ms;
+    double w = std::floor(budget_ms * m_config.sample_rate_hz / 1000.0) + 1.0;
+    if (w < 1.0) return 1;
+    return std::min(m_slots, static_cast<size_t>(w));
+}
+
+void SinStreamProcessor::push(double x) {
+    m_pending.push_back(x);
+    if (m_pending.size() >= window_size()) process_window();
+}
+
+void SinStreamProcessor::flush() {
+    if (!m_pending.empty()) process_window();
+}
+
+void SinStreamProcessor::process_window() {
+    const int64_t t = static_cast<int64_t>(m_cc->GetEncodingParams()->GetPlaintextModulus());
+
+    std::vector<int64_t> x_scaled(m_pending.size());
+    for (size_t i = 0; i < m_pending.size(); i++) {
+        x_scaled[i] = static_cast<int64_t>(std::round(m_poly.s * m_pending[i]));
+    }
+
+    auto start = Clock::now();
+    auto ct_x = m_cc->Encrypt(m_keyPair.publicKey, m_cc->MakePackedPlaintext(x_scaled));
+    auto ct_y = m_evaluator.evaluate(ct_x, m_poly);
+    Plaintext p_y;
+    m_cc->Decrypt(m_keyPair.secretKey, ct_y, &p_y);
+    p_y->SetLength(x_scaled.size());
+    const auto& packed = p_y->GetPackedValue();
+    double compute_ms = elapsed_ms(start, Clock::now());
+
+    for (size_t i = 0; i < x_scaled.size(); i++) {
+        m_sink(m_next_index + i, m_pending[i], static_cast<double>(centered_mod(packed[i], t)) / m_poly.scale);
+    }
+
+    // 샘플 클럭 기준: 마지막 샘플이 도착하고 이전 윈도우 처리가 끝난 뒤에 처리 시작
+    StreamWindowStat stat;
+    stat.first = m_next_index;
+    stat.count = x_scaled.size();
+    stat.compute_ms = compute_ms;
+    double first_arrival_ms = stat.first * 1000.0 / m_config.sample_rate_hz;
+    double last_arrival_ms = (stat.first + stat.count - 1) * 1000.0 / m_config.sample_rate_hz;
+    double done_ms = std::max(m_busy_until_ms, last_arrival_ms) + compute_ms;
+    stat.latency_ms = done_ms - first_arrival_ms;
+    stat.lag_ms = done_ms - last_arrival_ms;
+    m_windows.push_back(stat);
+
+    m_busy_until_ms = done_ms;
+    m_last_compute_ms = compute_ms;
+    m_next_index += stat.count;
+    m_pending.clear();
+}
+
+StreamReport SinStreamProcessor::report() const {
+    StreamReport report;
+    report.windows = m_windows.size();
+
+    std::vector<double> latencies;
+    size_t missed = 0;
+    for (const auto& w : m_windows) {
+        report.samples += w.count;
+        report.compute_ms += w.compute_ms;
+        report.max_lag_ms = std::max(report.max_lag_ms, w.lag_ms);
+        latencies.push_back(w.latency_ms);
+        if (w.latency_ms > m_config.deadline_ms) missed++;
+    }
+    if (m_windows.empty()) return report;
+
+    report.final_lag_ms = m_windows.back().lag_ms;
+    report.samples_per_sec = report.compute_ms > 0.0 ? report.samples * 1000.0 / report.compute_ms : 0.0;
+    report.realtime_factor = report.samples_per_sec / m_config.sample_rate_hz;
+    report.deadline_miss = static_cast<double>(missed) / m_windows.size();
+
+    std::sort(latencies.begin(), latencies.end());
+    report.latency_p50_ms = percentile(latencies, 50.0);
+    report.latency_p99_ms = percentile(latencies, 99.0);
+    return report;
+}
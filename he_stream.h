@@ -0,0 +1,77 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_poly_eval.h"
+
+#include <functional>
+
+// ====== 스트리밍 시계열 sin 평가 ======
+// 일정 주기로 들어오는 각도 샘플을 슬롯 패킹 윈도우로 묶어 암호공간에서 평가하고, 결과를 입력 순서대로 내보낸다.
+// 샘플 i 는 샘플 클럭 기준 i / sample_rate 초에 도착한 것으로 보고, 한 코어가 윈도우를 순서대로 처리할 때
+// 결과가 샘플 클럭보다 얼마나 늦는지(lag)를 측정된 처리 시간으로 계산한다.
+
+// talyor.m 과 같은 경계 반발 랜덤워크 각도 신호 (rad, T = 0.01, step = 0.05 * randn, 경계 ±pi/2)
+std::vector<double> generate_random_walk(size_t n, uint32_t seed = 1);
+
+struct StreamConfig {
+    double sample_rate_hz = 100.0;
+    double deadline_ms = 500.0;  // 윈도우 첫 샘플 도착부터 결과 출력까지 허용 지연
+};
+
+struct StreamWindowStat {
+    size_t first = 0;          // 첫 샘플 번호
+    size_t count = 0;          // 샘플 수
+    double compute_ms = 0.0;   // 암호화 + 평가 + 복호화
+    double latency_ms = 0.0;   // 첫 샘플 도착 -> 결과 (샘플 클럭 기준)
+    double lag_ms = 0.0;       // 마지막 샘플 도착 -> 결과 (샘플 클럭 기준)
+};
+
+struct StreamReport {
+    size_t samples = 0;
+    size_t windows = 0;
+    double compute_ms = 0.0;         // 실제 처리 시간 합
+    double samples_per_sec = 0.0;    // 처리 시간 기준 지속 처리량
+    double realtime_factor = 0.0;    // 처리량 / 샘플링 속도 (1 이상이면 실시간 유지)
+    double max_lag_ms = 0.0;
+    double final_lag_ms = 0.0;
+    double latency_p50_ms = 0.0;
+    double latency_p99_ms = 0.0;
+    double deadline_miss = 0.0;      // 마감을 넘긴 윈도우 비율
+};
+
+class SinStreamProcessor {
+public:
+    // 결과 콜백: (샘플 번호, 입력 x, 근사값) 을 입력 순서대로 호출
+    using Sink = std::function<void(size_t, double, double)>;
+
+    SinStreamProcessor(CryptoContext<DCRTPoly> cc, KeyPair<DCRTPoly> keyPair,
+                       ScaledPolynomial poly, StreamConfig config, Sink sink);
+
+    // 샘플 하나 추가 (윈도우가 차면 바로 평가)
+    void push(double x);
+
+    // 남은 샘플 평가
+    void flush();
+
+    const std::vector<StreamWindowStat>& windows() const { return m_windows; }
+    StreamReport report() const;
+
+private:
+    // 마감 안에 처리가 끝나도록 하는 윈도우 크기 (직전 윈도우 처리 시간으로 갱신)
+    size_t window_size() const;
+    void process_window();
+
+    CryptoContext<DCRTPoly> m_cc;
+    KeyPair<DCRTPoly> m_keyPair;
+    ScaledPolynomial m_poly;
+    StreamConfig m_config;
+    Sink m_sink;
+    PolyEvaluator m_evaluator;
+    size_t m_slots;
+
+    std::vector<double> m_pending;
+    size_t m_next_index = 0;      // m_pending[0] 의 샘플 번호
+    double m_busy_until_ms = 0.0; // 샘플 클럭 기준 코어가 비는 시점
+    double m_last_compute_ms = 0.0;
+    std::vector<StreamWindowStat> m_windows;
+};
@@ -0,0 +1,322 @@
+#include "he_trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <malloc.h>
+
+std::atomic<bool> g_trace_enabled{false};
+
+namespace {
+
+// malloc 이 내준 바이트 (mallinfo2 는 arena 를 모두 잠그고 훑으므로 추적이 켜져 있을 때만 부른다)
+int64_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const struct mallinfo2 info = mallinfo2();
+    return static_cast<int64_t>(info.uordblks + info.hblkhd);
+#else
+    return 0;  // mallinfo2 가 없는 libc: 힙 변화는 0 으로 남는다
+#endif
+}
+
+struct CtInfo {
+    int level = -1;          // GetLevel (버린 타워 수)
+    int towers = -1;         // RNS 타워 수
+    int noise_deg = -1;      // noise scale degree
+    int elements = -1;       // 성분 수 (재선형화 전 3)
+};
+
+struct TraceEvent {
+    const char* name = "";
+    const char* label = nullptr;  // 래퍼 호출 위치 이름 (예: "term3")
+    bool scope = false;      // TraceScope 구간이면 true
+    double ts_us = 0.0;      // 추적 시작 기준
+    double dur_us = 0.0;
+    uint32_t tid = 0;
+    CtInfo in, out;
+    int64_t heap_delta = 0;  // 연산 전후 힙 사용량 차이 (바이트)
+    uint32_t key_switches = 0;
+};
+
+// 요약 / 타임라인에 쓰는 이름: "연산" 또는 "연산 label"
+std::string display_name(const TraceEvent& event) {
+    return event.label ? std::string(event.name) + " " + event.label : std::string(event.name);
+}
+
+struct TraceState {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::string path;
+    Clock::time_point origin = Clock::now();
+    std::atomic<uint32_t> next_tid{0};
+};
+
+TraceState& state() {
+    static TraceState* s = new TraceState();  // 종료 순서와 무관하게 살아 있도록 해제하지 않는다
+    return *s;
+}
+
+uint32_t thread_index() {
+    thread_local uint32_t tid = state().next_tid.fetch_add(1);
+    return tid;
+}
+
+CtInfo ct_info(const ConstCiphertext<DCRTPoly>& ct) {
+    CtInfo info;
+    if (!ct) return info;
+    info.level = static_cast<int>(ct->GetLevel());
+    info.noise_deg = static_cast<int>(ct->GetNoiseScaleDeg());
+    info.elements = static_cast<int>(ct->GetElements().size());
+    info.towers = info.elements > 0 ? static_cast<int>(ct->GetElements()[0].GetNumOfElements()) : -1;
+    return info;
+}
+
+void record(TraceEvent event) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.events.push_back(event);
+}
+
+// 연산 하나: 시작 시점과 힙 사용량을 잡아 두고 finish 에서 이벤트를 남긴다
+class OpTimer {
+public:
+    OpTimer(const char* name, const char* label, const ConstCiphertext<DCRTPoly>& input, uint32_t key_switches)
+        : m_heap(heap_in_use()), m_start(Clock::now()) {
+        m_event.name = name;
+        m_event.label = label;
+        m_event.in = ct_info(input);
+        m_event.key_switches = key_switches;
+    }
+
+    void finish(const ConstCiphertext<DCRTPoly>& output) {
+        auto end = Clock::now();
+        m_event.out = ct_info(output);
+        m_event.heap_delta = heap_in_use() - m_heap;
+        m_event.ts_us = std::chrono::duration<double, std::micro>(m_start - state().origin).count();
+        m_event.dur_us = std::chrono::duration<double, std::micro>(end - m_start).count();
+        m_event.tid = thread_index();
+        record(m_event);
+    }
+
+private:
+    int64_t m_heap;
+    Clock::time_point m_start;
+    TraceEvent m_event;
+};
+
+template <typename Fn>
+Ciphertext<DCRTPoly> traced_ct_op(const char* name, const char* label, const ConstCiphertext<DCRTPoly>& input,
+                                  uint32_t key_switches, Fn&& fn) {
+    if (!trace_enabled()) return fn();
+    OpTimer timer(name, label, input, key_switches);
+    auto result = fn();
+    timer.finish(result);
+    return result;
+}
+
+void write_info(std::ostream& os, const char* prefix, const CtInfo& info) {
+    if (info.level < 0) return;
+    os << ",\"" << prefix << "_level\":" << info.level << ",\"" << prefix << "_towers\":" << info.towers << ",\""
+       << prefix << "_noise_deg\":" << info.noise_deg << ",\"" << prefix << "_elements\":" << info.elements;
+}
+
+// ENC_SIN_TRACE 가 있으면 시작할 때 켜고 종료할 때 저장
+struct EnvTrace {
+    EnvTrace() {
+        const char* path = std::getenv("ENC_SIN_TRACE");
+        if (path && *path) {
+            trace_enable(path);
+            std::atexit([] { trace_flush(std::cout); });
+        }
+    }
+} g_env_trace;
+
+}  // namespace
+
+void trace_enable(const std::string& path) {
+    auto& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.path = path;
+        s.origin = Clock::now();
+    }
+    g_trace_enabled.store(true, std::memory_order_relaxed);
+}
+
+bool trace_write_json(const std::string& path) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    std::ofstream os(path);
+    if (!os) return false;
+
+    os << std::fixed << std::setprecision(3);
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t i = 0; i < s.events.size(); i++) {
+        const auto& e = s.events[i];
+        os << "{\"name\":\"" << display_name(e) << "\",\"cat\":\"" << (e.scope ? "scope" : "op")
+           << "\",\"ph\":\"X\",\"ts\":" << e.ts_us << ",\"dur\":" << e.dur_us << ",\"pid\":1,\"tid\":" << e.tid
+           << ",\"args\":{\"heap_net_delta_bytes\":" << e.heap_delta << ",\"key_switches\":" << e.key_switches;
+        write_info(os, "in", e.in);
+        write_info(os, "out", e.out);
+        os << "}}" << (i + 1 < s.events.size() ? ",\n" : "\n");
+    }
+    os << "]}\n";
+    return static_cast<bool>(os);
+}
+
+void trace_print_summary(std::ostream& os) {
+    struct Row {
+        size_t calls = 0;
+        double total_us = 0.0;
+        double max_us = 0.0;
+        int64_t heap_delta = 0;
+        uint64_t key_switches = 0;
+        bool scope = false;
+    };
+    std::map<std::string, Row> rows;
+    double op_total_us = 0.0;
+    {
+        auto& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (const auto& e : s.events) {
+            auto& row = rows[display_name(e)];
+            row.calls++;
+            row.total_us += e.dur_us;
+            row.max_us = std::max(row.max_us, e.dur_us);
+            row.heap_delta += e.heap_delta;
+            row.key_switches += e.key_switches;
+            row.scope = e.scope;
+            if (!e.scope) op_total_us += e.dur_us;
+        }
+    }
+
+    std::vector<std::pair<std::string, Row>> sorted(rows.begin(), rows.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& a, const auto& b) { return a.second.total_us > b.second.total_us; });
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "\n=== 연산별 추적 요약 ===" << std::endl;
+    os << "연산\t호출\t합계(ms)\t평균(ms)\t최대(ms)\t비중\t힙 순변화(KB, 프로세스)\t키 스위칭" << std::endl;
+    for (const auto& [name, row] : sorted) {
+        os << (row.scope ? "[" + name + "]" : name) << "\t" << row.calls << "\t" << row.total_us / 1000.0 << "\t"
+           << row.total_us / 1000.0 / row.calls << "\t" << row.max_us / 1000.0 << "\t"
+           << (row.scope || op_total_us <= 0.0 ? std::string("-")
+                                               : std::to_string(static_cast<int>(100.0 * row.total_us / op_total_us)) + "%")
+           << "\t" << row.heap_delta / 1024 << "\t" << row.key_switches << std::endl;
+    }
+    os << "([이름] 은 TraceScope 구간, 비중은 연산 시간 합 기준)" << std::endl;
+    os << "(힙 순변화는 mallinfo2 로 읽은 프로세스 전체 힙 사용량의 연산 전후 차이: 할당량이 아니며 다른 스레드 몫도 섞임)"
+       << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void trace_flush(std::ostream& os) {
+    std::string path;
+    {
+        auto& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (s.events.empty()) return;
+        path = s.path;
+    }
+    if (!path.empty()) {
+        trace_print_summary(os);
+        if (trace_write_json(path)) {
+            os << "추적 파일: " << path << " (chrome://tracing 또는 ui.perfetto.dev 에서 열기)" << std::endl;
+        } else {
+            os << "추적 파일을 쓸 수 없습니다: " << path << std::endl;
+        }
+    }
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.events.clear();
+}
+
+TraceScope::TraceScope(const char* name) : m_name(name), m_active(trace_enabled()) {
+    if (m_active) {
+        m_heap = heap_in_use();
+        m_start = Clock::now();
+    }
+}
+
+TraceScope::~TraceScope() {
+    if (!m_active) return;
+    auto end = Clock::now();
+    TraceEvent event;
+    event.name = m_name;
+    event.scope = true;
+    event.ts_us = std::chrono::duration<double, std::micro>(m_start - state().origin).count();
+    event.dur_us = std::chrono::duration<double, std::micro>(end - m_start).count();
+    event.tid = thread_index();
+    event.heap_delta = heap_in_use() - m_heap;
+    record(event);
+}
+
+// ====== 래퍼 ======
+
+Plaintext traced_make_packed_plaintext(const CryptoContext<DCRTPoly>& cc, const std::vector<int64_t>& values,
+                                       const char* label) {
+    if (!trace_enabled()) return cc->MakePackedPlaintext(values);
+    OpTimer timer("MakePackedPlaintext", label, nullptr, 0);
+    auto pt = cc->MakePackedPlaintext(values);
+    timer.finish(nullptr);
+    return pt;
+}
+
+Ciphertext<DCRTPoly> traced_encrypt(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                    const Plaintext& pt, const char* label) {
+    return traced_ct_op("Encrypt", label, nullptr, 0, [&] { return cc->Encrypt(publicKey, pt); });
+}
+
+Ciphertext<DCRTPoly> traced_eval_mult(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                      const ConstCiphertext<DCRTPoly>& b, const char* label) {
+    return traced_ct_op("EvalMult(ct,ct)", label, a, 1, [&] { return cc->EvalMult(a, b); });
+}
+
+Ciphertext<DCRTPoly> traced_eval_mult(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                      const ConstPlaintext& b, const char* label) {
+    return traced_ct_op("EvalMult(ct,pt)", label, a, 0, [&] { return cc->EvalMult(a, b); });
+}
+
+Ciphertext<DCRTPoly> traced_eval_mult_no_relin(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                               const ConstCiphertext<DCRTPoly>& b, const char* label) {
+    return traced_ct_op("EvalMultNoRelin", label, a, 0, [&] { return cc->EvalMultNoRelin(a, b); });
+}
+
+Ciphertext<DCRTPoly> traced_eval_add(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                     const ConstCiphertext<DCRTPoly>& b, const char* label) {
+    return traced_ct_op("EvalAdd(ct,ct)", label, a, 0, [&] { return cc->EvalAdd(a, b); });
+}
+
+Ciphertext<DCRTPoly> traced_eval_add(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                     const ConstPlaintext& b, const char* label) {
+    return traced_ct_op("EvalAdd(ct,pt)", label, a, 0, [&] { return cc->EvalAdd(a, b); });
+}
+
+Ciphertext<DCRTPoly> traced_relinearize(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct,
+                                        const char* label) {
+    return traced_ct_op("Relinearize", label, ct, 1, [&] { return cc->Relinearize(ct); });
+}
+
+Ciphertext<DCRTPoly> traced_mod_reduce(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct,
+                                       const char* label) {
+    return traced_ct_op("ModReduce", label, ct, 0, [&] { return cc->ModReduce(ct); });
+}
+
+DecryptResult traced_decrypt(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                             const ConstCiphertext<DCRTPoly>& ct, Plaintext* plaintext, const char* label) {
+    if (!trace_enabled()) return cc->Decrypt(secretKey, ct, plaintext);
+    OpTimer timer("Decrypt", label, ct, 0);
+    auto result = cc->Decrypt(secretKey, ct, plaintext);
+    timer.finish(nullptr);
+    return result;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "he_common.h"
+
+#include <atomic>
+#include <iosfwd>
+#include <string>
+
+// ====== 연산 단위 추적 (Chrome trace) ======
+// CryptoContext 호출을 감싸 연산마다 벽시계 시간, 입력/출력 암호문의 레벨 · 타워 수 · noise scale degree ·
+// 성분 수, 연산 전후 힙 사용량 변화, 키 스위칭 수를 기록한다. 결과는 Chrome trace JSON
+// (chrome://tracing, https://ui.perfetto.dev) 과 연산별 합계 요약으로 내보낸다.
+// - 켜기: 환경변수 ENC_SIN_TRACE=경로 (프로그램 종료 시 저장 + 요약 출력) 또는 trace_enable(경로)
+// - 꺼져 있으면 (기본) 래퍼는 플래그 하나만 확인하고 바로 OpenFHE 를 호출한다
+// - 힙 변화는 추적이 켜져 있을 때만 mallinfo2() 로 연산 전후를 읽은 차이 (할당 - 해제, 음수 가능).
+//   프로세스 전체 값이라 다른 스레드의 동시 연산이 섞일 수 있다
+// - 래퍼의 label (예: "term3") 은 같은 연산을 호출 위치별로 나눠 요약 / 타임라인에 "연산 label" 로 표시한다
+// - BGV 잡음 예산은 비밀키 없이 알 수 없으므로 noise scale degree 와 레벨로 대신한다
+
+extern std::atomic<bool> g_trace_enabled;
+
+inline bool trace_enabled() {
+    return g_trace_enabled.load(std::memory_order_relaxed);
+}
+
+// 추적 시작 (path 가 비어 있지 않으면 종료 시 또는 trace_flush 때 그 경로에 JSON 저장)
+void trace_enable(const std::string& path);
+
+// 지금까지의 이벤트를 JSON 으로 저장하고 (경로가 있으면) 요약을 os 에 출력한 뒤 이벤트를 비운다
+void trace_flush(std::ostream& os);
+
+// 연산별 합계 (호출 수, 시간 합/평균/최대, 힙 변화, 키 스위칭) 를 시간 합 순으로 출력
+void trace_print_summary(std::ostream& os);
+
+// Chrome trace 형식 ({"traceEvents": [...]}) 으로 저장
+bool trace_write_json(const std::string& path);
+
+// 이름 붙은 구간 (예: "term3"). 안의 연산들이 타임라인에서 이 구간 아래에 겹쳐 보인다
+class TraceScope {
+public:
+    explicit TraceScope(const char* name);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;
+    bool m_active;
+    Clock::time_point m_start;
+    int64_t m_heap = 0;
+};
+
+// ====== 추적 래퍼 (꺼져 있으면 OpenFHE 호출과 같음) ======
+// label 은 문자열 리터럴처럼 추적이 끝날 때까지 살아 있는 문자열 (nullptr 이면 연산 이름만)
+Plaintext traced_make_packed_plaintext(const CryptoContext<DCRTPoly>& cc, const std::vector<int64_t>& values,
+                                       const char* label = nullptr);
+
+Ciphertext<DCRTPoly> traced_encrypt(const CryptoContext<DCRTPoly>& cc, const PublicKey<DCRTPoly>& publicKey,
+                                    const Plaintext& pt, const char* label = nullptr);
+
+// ct x ct (재선형화 포함, 키 스위칭 1회)
+Ciphertext<DCRTPoly> traced_eval_mult(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                      const ConstCiphertext<DCRTPoly>& b, const char* label = nullptr);
+
+// ct x pt
+Ciphertext<DCRTPoly> traced_eval_mult(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                      const ConstPlaintext& b, const char* label = nullptr);
+
+// ct x ct (재선형화 없음, 3성분 결과)
+Ciphertext<DCRTPoly> traced_eval_mult_no_relin(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                               const ConstCiphertext<DCRTPoly>& b, const char* label = nullptr);
+
+Ciphertext<DCRTPoly> traced_eval_add(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                     const ConstCiphertext<DCRTPoly>& b, const char* label = nullptr);
+
+Ciphertext<DCRTPoly> traced_eval_add(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& a,
+                                     const ConstPlaintext& b, const char* label = nullptr);
+
+// 키 스위칭 1회
+Ciphertext<DCRTPoly> traced_relinearize(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct,
+                                        const char* label = nullptr);
+
+Ciphertext<DCRTPoly> traced_mod_reduce(const CryptoContext<DCRTPoly>& cc, const ConstCiphertext<DCRTPoly>& ct,
+                                       const char* label = nullptr);
+
+DecryptResult traced_decrypt(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                             const ConstCiphertext<DCRTPoly>& ct, Plaintext* plaintext, const char* label = nullptr);
@@ -0,0 +1,217 @@
+#include "he_tune.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "he_modmath.h"
+
+namespace {
+
+// 정수 계수 오버플로우 방지: s^(n-1) * denom 이 int64 안에 들어가야 한다
+bool coeffs_fit(size_t degree, int64_t s, int64_t denom) {
+    return std::pow(static_cast<long double>(s), degree - 1) * denom <= 4e18L;
+}
+
+// 실수 테일러 다항식의 x_max 에서의 절단 오차 (정수화 이전, 이보다 작은 오차는 불가능)
+double truncation_error(size_t degree, double x_max) {
+    double term = x_max;
+    double sum = 0.0;
+    for (size_t k = 1; k <= degree; k += 2) {
+        sum += term;
+        term *= -x_max * x_max / static_cast<double>((k + 1) * (k + 2));
+    }
+    return std::abs(sum - std::sin(x_max));
+}
+
+}  // namespace
+
+IntegerPlan simulate_integer_pipeline(const ScaledPolynomial& poly, int64_t denom, double x_max) {
+    IntegerPlan plan;
+    plan.poly = poly;
+    plan.denom = denom;
+
+    const int64_t x_limit = std::llround(poly.s * x_max);
+    for (int64_t x = -x_limit; x <= x_limit; x++) {
+        int128_t acc = 0;
+        for (size_t k = poly.coeffs.size(); k-- > 0;) {
+            acc = acc * x + poly.coeffs[k];
+        }
+        plan.y_max = std::max(plan.y_max, acc < 0 ? -acc : acc);
+        long double y = static_cast<long double>(acc) / poly.scale;
+        double error = static_cast<double>(std::abs(y - std::sin(static_cast<long double>(x) / poly.s)));
+        plan.max_error = std::max(plan.max_error, error);
+    }
+    plan.max_error += 0.5 / poly.s;
+    return plan;
+}
+
+std::vector<IntegerPlan> find_integer_plans(const TuneTarget& target) {
+    // t 는 OpenFHE 평문 모듈러스 한도(60비트) 아래여야 한다
+    const int128_t y_limit = static_cast<int128_t>(1) << 58;
+    const int64_t s_start = std::max<int64_t>(2, static_cast<int64_t>(std::ceil(0.5 / target.max_error)));
+
+    std::vector<IntegerPlan> plans;
+    for (size_t degree = 3; degree <= target.max_degree; degree += 2) {
+        if (truncation_error(degree, target.x_max) >= target.max_error) continue;
+
+        int64_t factorial = 1;
+        for (size_t k = 2; k <= degree; k++) factorial *= k;
+
+        for (int64_t multiple : {1, 10, 100}) {
+            const int64_t denom = factorial * multiple;
+            for (int64_t s = s_start; s <= 8 * s_start; s += std::max<int64_t>(1, s / 64)) {
+                if (!coeffs_fit(degree, s, denom)) break;
+                auto plan = simulate_integer_pipeline(make_taylor_sin(degree, s, denom), denom, target.x_max);
+                if (plan.y_max >= y_limit) break;
+                if (plan.max_error <= target.max_error) {
+                    plans.push_back(plan);
+                    break;
+                }
+            }
+        }
+    }
+    return plans;
+}
+
+CCParams<CryptoContextBGVRNS> make_tuned_params(const TunedConfig& config) {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(config.plaintext_modulus);
+    parameters.SetMultiplicativeDepth(config.depth);
+    parameters.SetSecurityLevel(config.security);
+    parameters.SetRingDim(config.ring_dim);
+    return parameters;
+}
+
+std::vector<TunedConfig> tune_parameters(const TuneTarget& target, bool measure) {
+    std::vector<TunedConfig> candidates;
+    for (const auto& plan : find_integer_plans(target)) {
+        TunedConfig config;
+        config.degree = plan.poly.degree();
+        config.s = plan.poly.s;
+        config.denom = plan.denom;
+        config.depth = required_depth(config.degree);
+        config.security = target.security;
+        config.x_max = target.x_max;
+        config.max_error = plan.max_error;
+
+        // 보안 수준을 만족할 때까지 링 차원을 두 배씩 늘린다 (t 는 링 차원마다 다시 선택)
+        CryptoContext<DCRTPoly> cc;
+        for (uint32_t ring_dim = target.min_ring_dim; ring_dim <= 131072 && !cc; ring_dim *= 2) {
+            uint64_t t = next_packing_prime(static_cast<uint64_t>(2 * plan.y_max + 1), ring_dim);
+            if (t >= (uint64_t(1) << 60)) break;
+            config.ring_dim = ring_dim;
+            config.plaintext_modulus = t;
+            try {
+                CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+                cc = GenCryptoContext(make_tuned_params(config));
+            } catch (const std::exception&) {
+                cc = nullptr;
+            }
+        }
+        if (!cc) continue;
+
+        config.towers = cc->GetElementParams()->GetParams().size();
+        const auto ops = plan_poly_eval(plan.poly);
+        const double n = config.ring_dim;
+        config.model_cost = n * std::log2(n) * config.towers
+                            * (ops.key_switches * (config.towers + 2.0) + ops.ct_mults + ops.pt_mults) / 1e6;
+
+        if (measure) {
+            cc->Enable(PKE);
+            cc->Enable(KEYSWITCH);
+            cc->Enable(LEVELEDSHE);
+            auto keyPair = cc->KeyGen();
+            cc->EvalMultKeyGen(keyPair.secretKey);
+
+            // 입력 범위 전체를 슬롯에 채워 평가하고 평문 모의 결과와 비교
+            const int64_t x_limit = std::llround(config.s * config.x_max);
+            std::vector<int64_t> inputs(slot_count(cc));
+            for (size_t i = 0; i < inputs.size(); i++) {
+                inputs[i] = -x_limit + static_cast<int64_t>(i % (2 * x_limit + 1));
+            }
+            auto ct_x = cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext(inputs));
+
+            PolyEvaluator evaluator(cc);
+            Ciphertext<DCRTPoly> ct_y;
+            std::vector<double> samples;
+            for (int i = 0; i < 3; i++) {
+                auto start = Clock::now();
+                ct_y = evaluator.evaluate(ct_x, plan.poly);
+                samples.push_back(elapsed_ms(start, Clock::now()));
+            }
+
+            Plaintext p_y;
+            cc->Decrypt(keyPair.secretKey, ct_y, &p_y);
+            p_y->SetLength(inputs.size());
+            const int64_t t = static_cast<int64_t>(config.plaintext_modulus);
+            bool correct = true;
+            for (size_t i = 0; i < inputs.size() && correct; i++) {
+                correct = centered_mod(p_y->GetPackedValue()[i], t) == eval_scaled_plain(plan.poly, inputs[i], t);
+            }
+            if (!correct) continue;
+            config.measured_ms = median_of(samples);
+        }
+        candidates.push_back(config);
+    }
+    CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+
+    std::sort(candidates.begin(), candidates.end(), [measure](const TunedConfig& a, const TunedConfig& b) {
+        return measure ? a.measured_ms < b.measured_ms : a.model_cost < b.model_cost;
+    });
+    return candidates;
+}
+
+std::string security_name(SecurityLevel security) {
+    switch (security) {
+        case SecurityLevel::HEStd_128_classic: return "128";
+        case SecurityLevel::HEStd_192_classic: return "192";
+        case SecurityLevel::HEStd_256_classic: return "256";
+        default: return "notset";
+    }
+}
+
+SecurityLevel parse_security(const std::string& name) {
+    if (name == "128") return SecurityLevel::HEStd_128_classic;
+    if (name == "192") return SecurityLevel::HEStd_192_classic;
+    if (name == "256") return SecurityLevel::HEStd_256_classic;
+    return SecurityLevel::HEStd_NotSet;
+}
+
+void write_tuned_config(const std::string& path, const TunedConfig& config) {
+    std::ofstream os(path);
+    os << "# sin_tune 결과 (sin_taylor_poly --config 로 사용)\n";
+    os << "degree=" << config.degree << "\n";
+    os << "s=" << config.s << "\n";
+    os << "denom=" << config.denom << "\n";
+    os << "plaintext_modulus=" << config.plaintext_modulus << "\n";
+    os << "ring_dim=" << config.ring_dim << "\n";
+    os << "multiplicative_depth=" << config.depth << "\n";
+    os << "security=" << security_name(config.security) << "\n";
+    os << "x_max=" << config.x_max << "\n";
+    os << "max_error=" << config.max_error << "\n";
+}
+
+bool load_tuned_config(const std::string& path, TunedConfig& config) {
+    std::ifstream is(path);
+    if (!is) return false;
+
+    std::string line;
+    while (std::getline(is, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        auto eq = line.find('=');
+        if (eq == std::string::npos) continue;
+        const std::string key = line.substr(0, eq);
+        std::istringstream value(line.substr(eq + 1));
+        if (key == "degree") value >> config.degree;
+        else if (key == "s") value >> config.s;
+        else if (key == "denom") value >> config.denom;
+        else if (key == "plaintext_modulus") value >> config.plaintext_modulus;
+        else if (key == "ring_dim") value >> config.ring_dim;
+        else if (key == "multiplicative_depth") value >> config.depth;
+        else if (key == "security") config.security = parse_security(value.str());
+        else if (key == "x_max") value >> config.x_max;
+        else if (key == "max_error") value >> config.max_error;
+    }
+    return config.degree > 0 && config.plaintext_modulus > 0;
+}
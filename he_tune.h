@@ -0,0 +1,64 @@
+#pragma once
+
+#include "he_common.h"
+#include "he_modmath.h"
+#include "he_poly_eval.h"
+
+#include <cmath>
+#include <string>
+
+// ====== 파라미터 자동 튜너 ======
+// 입력 범위 |x| <= x_max 와 허용 오차 max_error, 보안 수준이 주어지면
+// 1) 정수 파이프라인을 평문에서 정확히(128비트, mod 없이) 모의해 오차와 wraparound 가 없는 (차수, s, denom) 을 찾고
+// 2) 최대 |y_scaled| 를 담는 슬롯 패킹 소수 t 와 보안 수준을 만족하는 링 차원을 정한 뒤
+// 3) 모델 비용(또는 실측 지연)이 가장 낮은 조합을 고른다.
+
+struct TuneTarget {
+    double x_max = M_PI;          // 입력 범위 (rad)
+    double max_error = 1e-2;      // 허용 최대 절대 오차 (입력 양자화 포함)
+    SecurityLevel security = SecurityLevel::HEStd_NotSet;
+    size_t max_degree = 9;        // 탐색할 최대 차수 (홀수)
+    uint32_t min_ring_dim = 4096; // HEStd_NotSet 일 때 사용할 링 차원 (슬롯 수)
+};
+
+// 정수 파이프라인 모의 결과
+struct IntegerPlan {
+    ScaledPolynomial poly;
+    int64_t denom = 1;
+    double max_error = 0.0;   // max |y_scaled / scale - sin(x)|, |x| <= x_max
+    int128_t y_max = 0;       // max |y_scaled| (mod 없는 정확한 값)
+};
+
+struct TunedConfig {
+    size_t degree = 0;
+    int64_t s = 1;
+    int64_t denom = 1;
+    uint64_t plaintext_modulus = 0;
+    uint32_t ring_dim = 0;
+    uint32_t depth = 0;
+    SecurityLevel security = SecurityLevel::HEStd_NotSet;
+    double x_max = 0.0;
+    double max_error = 0.0;    // 모의로 확인한 최대 오차
+    size_t towers = 0;         // 신선한 암호문의 RNS 타워 수
+    double model_cost = 0.0;   // 상대 비용 (N log N * 타워 수 * 연산 수)
+    double measured_ms = -1.0; // 실측 평가 지연 (측정하지 않았으면 음수)
+};
+
+// |x| <= x_max 의 모든 정수 입력 x_scaled 에 대해 poly 를 mod 없이 평가해 오차와 최대 |y_scaled| 계산.
+// x = x_scaled / s 주변 양자화 구간(±0.5/s) 오차는 sin 의 립시츠 상수 1 로 더해 보수적으로 잡는다.
+IntegerPlan simulate_integer_pipeline(const ScaledPolynomial& poly, int64_t denom, double x_max);
+
+// 차수/denom 배수별로 max_error 를 만족하는 가장 작은 s 의 계획 목록
+std::vector<IntegerPlan> find_integer_plans(const TuneTarget& target);
+
+// 정수 계획마다 t, 링 차원, 뎁스를 정하고 비용순으로 정렬한 후보 목록 (measure 면 실제로 키 생성 + 평가 시간 측정)
+std::vector<TunedConfig> tune_parameters(const TuneTarget& target, bool measure);
+
+CCParams<CryptoContextBGVRNS> make_tuned_params(const TunedConfig& config);
+
+// key=value 텍스트 설정 파일
+void write_tuned_config(const std::string& path, const TunedConfig& config);
+bool load_tuned_config(const std::string& path, TunedConfig& config);
+
+std::string security_name(SecurityLevel security);
+SecurityLevel parse_security(const std::string& name);
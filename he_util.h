@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ====== 공통 유틸리티 (평문 전용) ======
+// 실행파일들이 공유하는 시간 측정, centered mod 보정, 명령행 인자, 샘플 백분위수 헬퍼.
+// OpenFHE 에 의존하지 않아 평문 전용 실행파일 (ntt_bench) 도 쓸 수 있다.
+
+using Clock = std::chrono::high_resolution_clock;
+
+// 두 시점 사이의 경과 시간 (ms)
+inline double elapsed_ms(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+}
+
+// [0, t) 또는 임의 범위의 값을 (-t/2, t/2] 로 보정
+inline int64_t centered_mod(int64_t value, int64_t t) {
+    value %= t;
+    if (value > t / 2) value -= t;
+    if (value < -t / 2) value += t;
+    return value;
+}
+
+// 음수 계수를 [0, t) 로 올림 (기존 ic3_mod 계산과 동일)
+inline int64_t positive_mod(int64_t value, int64_t t) {
+    value %= t;
+    return (value < 0) ? value + t : value;
+}
+
+// ====== 명령행 인자 ======
+// "--name value" 형태의 인자 (없으면 default_value)
+inline std::string arg_str(int argc, char* argv[], const std::string& name, const std::string& default_value) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (name == argv[i]) return argv[i + 1];
+    }
+    return default_value;
+}
+
+inline int64_t arg_int(int argc, char* argv[], const std::string& name, int64_t default_value) {
+    std::string value = arg_str(argc, argv, name, "");
+    return value.empty() ? default_value : std::strtoll(value.c_str(), nullptr, 10);
+}
+
+inline double arg_double(int argc, char* argv[], const std::string& name, double default_value) {
+    std::string value = arg_str(argc, argv, name, "");
+    return value.empty() ? default_value : std::strtod(value.c_str(), nullptr);
+}
+
+// "--name a,b,c" 형태의 쉼표 목록
+inline std::vector<std::string> arg_str_list(int argc, char* argv[], const std::string& name, const std::string& default_value) {
+    std::vector<std::string> values;
+    std::stringstream ss(arg_str(argc, argv, name, default_value));
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) values.push_back(item);
+    }
+    return values;
+}
+
+inline std::vector<int64_t> arg_int_list(int argc, char* argv[], const std::string& name, const std::string& default_value) {
+    std::vector<int64_t> values;
+    for (const auto& item : arg_str_list(argc, argv, name, default_value)) {
+        values.push_back(std::strtoll(item.c_str(), nullptr, 10));
+    }
+    return values;
+}
+
+// "--name" 플래그 존재 여부
+inline bool arg_flag(int argc, char* argv[], const std::string& name) {
+    for (int i = 1; i < argc; i++) {
+        if (name == argv[i]) return true;
+    }
+    return false;
+}
+
+// ====== 샘플 통계 ======
+// 정렬된 샘플에서 백분위수 (p: 0~100)
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+// 정렬되지 않은 샘플의 백분위수 (복사본을 정렬)
+inline double percentile_of(std::vector<double> samples, double p) {
+    std::sort(samples.begin(), samples.end());
+    return percentile(samples, p);
+}
+
+inline double median_of(std::vector<double> samples) {
+    return percentile_of(std::move(samples), 50.0);
+}
+
+// fn 을 iters 번 실행한 시간 (ms) 의 중앙값
+template <typename Fn>
+double median_ms(size_t iters, Fn&& fn) {
+    std::vector<double> samples;
+    for (size_t r = 0; r < iters; r++) {
+        auto start = Clock::now();
+        fn();
+        samples.push_back(elapsed_ms(start, Clock::now()));
+    }
+    return median_of(std::move(samples));
+}
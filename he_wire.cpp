@@ -0,0 +1,143 @@
+#include "he_wire.h"
+
+#include <openfhe/pke/ciphertext-ser.h>
+#include <openfhe/pke/scheme/bgvrns/bgvrns-ser.h>
+
+#include <cerrno>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+const uint32_t kFrameMagic = 0x4E495345;  // "ESIN"
+
+struct FrameHeader {
+    uint32_t magic = kFrameMagic;
+    uint8_t type = 0;
+    uint8_t reserved[3] = {0, 0, 0};
+    uint64_t size = 0;
+};
+static_assert(sizeof(FrameHeader) == 16, "frame header must be 16 bytes");
+
+bool read_all(int fd, char* data, size_t size) {
+    while (size > 0) {
+        ssize_t n = ::read(fd, data, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+sockaddr_un unix_address(const std::string& path) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) throw std::runtime_error("소켓 경로가 너무 깁니다: " + path);
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+}
+
+}  // namespace
+
+bool send_frame(int fd, FrameType type, const void* prefix, size_t prefix_size, const char* body, size_t body_size) {
+    FrameHeader header;
+    header.type = static_cast<uint8_t>(type);
+    header.size = prefix_size + body_size;
+
+    iovec parts[3] = {
+        {&header, sizeof(header)},
+        {const_cast<void*>(prefix), prefix_size},
+        {const_cast<char*>(body), body_size},
+    };
+    int first = 0;
+    while (first < 3) {
+        // MSG_NOSIGNAL: 상대가 끊은 소켓에 쓰면 SIGPIPE 로 프로세스가 죽지 않고 EPIPE 로 실패한다
+        msghdr message;
+        std::memset(&message, 0, sizeof(message));
+        message.msg_iov = parts + first;
+        message.msg_iovlen = static_cast<size_t>(3 - first);
+        ssize_t n = ::sendmsg(fd, &message, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) return false;
+        // 부분 전송: 보낸 만큼 iovec 을 앞으로 이동
+        size_t sent = static_cast<size_t>(n);
+        while (first < 3 && sent >= parts[first].iov_len) {
+            sent -= parts[first].iov_len;
+            first++;
+        }
+        if (first < 3) {
+            parts[first].iov_base = static_cast<char*>(parts[first].iov_base) + sent;
+            parts[first].iov_len -= sent;
+        }
+    }
+    return true;
+}
+
+bool recv_frame(int fd, FrameType& type, std::vector<char>& buffer) {
+    FrameHeader header;
+    if (!read_all(fd, reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.magic != kFrameMagic) return false;
+    if (header.size > kMaxFrameBytes) return false;
+    type = static_cast<FrameType>(header.type);
+    buffer.resize(header.size);
+    return read_all(fd, buffer.data(), buffer.size());
+}
+
+void serialize_ciphertext(const Ciphertext<DCRTPoly>& ct, std::vector<char>& buffer) {
+    buffer.clear();
+    VectorStreamBuf streambuf(buffer);
+    std::ostream os(&streambuf);
+    Serial::Serialize(ct, os, SerType::BINARY);
+}
+
+Ciphertext<DCRTPoly> deserialize_ciphertext(const char* data, size_t size) {
+    MemoryStreamBuf streambuf(data, size);
+    std::istream is(&streambuf);
+    Ciphertext<DCRTPoly> ct;
+    Serial::Deserialize(ct, is, SerType::BINARY);
+    return ct;
+}
+
+int listen_unix(const std::string& path) {
+    sockaddr_un addr = unix_address(path);
+    // 이전 서버가 남긴 소켓 파일만 지운다: 연결이 되면 살아 있는 서버, 소켓이 아닌 파일은 건드리지 않음
+    struct stat st;
+    if (::lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+        int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (probe < 0) throw std::runtime_error("socket 실패: " + std::string(std::strerror(errno)));
+        const bool alive = ::connect(probe, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+        const int error = errno;
+        ::close(probe);
+        if (alive) throw std::runtime_error("이미 다른 서버가 사용 중인 소켓입니다: " + path);
+        if (error == ECONNREFUSED) ::unlink(path.c_str());
+    }
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) throw std::runtime_error("socket 실패: " + std::string(std::strerror(errno)));
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || ::listen(fd, 16) < 0) {
+        std::string message = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("소켓 바인드 실패 (" + path + "): " + message);
+    }
+    return fd;
+}
+
+int connect_unix(const std::string& path) {
+    sockaddr_un addr = unix_address(path);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) throw std::runtime_error("socket 실패: " + std::string(std::strerror(errno)));
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        std::string message = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("서버 연결 실패 (" + path + "): " + message);
+    }
+    return fd;
+}
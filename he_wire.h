@@ -0,0 +1,82 @@
+#pragma once
+
+#include "he_common.h"
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// ====== 암호문 전송 포맷 ======
+// 프레임 = 16바이트 헤더(magic, type, payload 길이) + payload.
+// 직렬화는 재사용 버퍼(VectorStreamBuf)에 바로 쓰고, 수신 버퍼는 MemoryStreamBuf 로 감싸 복사 없이 역직렬화한다
+// (중간 std::stringstream 없음). 헤더와 payload 는 sendmsg 로 한 번에 보낸다 (MSG_NOSIGNAL, 끊긴 연결은 SIGPIPE 대신 실패 반환).
+
+// 메모리 영역을 복사 없이 std::istream 으로 읽기 위한 streambuf
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(const char* data, size_t size) {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+// 재사용 가능한 std::vector<char> 에 이어 쓰는 출력 streambuf (clear 후에도 용량 유지)
+class VectorStreamBuf : public std::streambuf {
+public:
+    explicit VectorStreamBuf(std::vector<char>& buffer) : m_buffer(buffer) {}
+
+    void clear() { m_buffer.clear(); }
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        m_buffer.insert(m_buffer.end(), data, data + size);
+        return size;
+    }
+    int_type overflow(int_type ch) override {
+        if (ch != traits_type::eof()) m_buffer.push_back(static_cast<char>(ch));
+        return ch;
+    }
+
+private:
+    std::vector<char>& m_buffer;
+};
+
+enum class FrameType : uint8_t {
+    Params = 1,   // 서버 -> 클라이언트: 다항식 (s, scale, 계수)
+    Request = 2,  // 클라이언트 -> 서버: 요청 id + 입력 암호문
+    Result = 3,   // 서버 -> 클라이언트: ResultHeader + 결과 암호문
+    Error = 4,    // 서버 -> 클라이언트: 오류 메시지
+    Bye = 5,      // 클라이언트 -> 서버: 연결 종료
+};
+
+struct RequestHeader {
+    uint64_t request_id = 0;
+};
+
+struct ResultHeader {
+    uint64_t request_id = 0;
+    double deserialize_ms = 0.0;  // 서버의 요청 암호문 역직렬화 시간
+    double eval_ms = 0.0;         // 서버의 다항식 평가 시간
+    double serialize_ms = 0.0;    // 서버의 결과 암호문 직렬화 시간
+};
+
+// 수신 프레임 payload 최대 크기. 링 차원 32768, 타워 30개인 2성분 암호문(약 15 MB)의 4배 정도로,
+// 상대가 보낸 길이를 그대로 믿고 수 GB 를 할당하지 않도록 이보다 큰 프레임은 거부한다
+constexpr uint64_t kMaxFrameBytes = uint64_t(64) << 20;
+
+// 헤더 + payload(앞부분 prefix + 본문 body) 를 한 번의 sendmsg 로 전송 (상대가 끊었으면 false)
+bool send_frame(int fd, FrameType type, const void* prefix, size_t prefix_size, const char* body, size_t body_size);
+
+// 프레임 하나를 buffer 에 수신 (buffer 는 재사용, 크기는 payload 길이로 맞춰짐).
+// 연결 종료/오류, 잘못된 magic, kMaxFrameBytes 를 넘는 길이면 false
+bool recv_frame(int fd, FrameType& type, std::vector<char>& buffer);
+
+// 암호문을 buffer 에 직렬화 (buffer 는 비우고 다시 채움)
+void serialize_ciphertext(const Ciphertext<DCRTPoly>& ct, std::vector<char>& buffer);
+
+// data[0, size) 에서 복사 없이 암호문 역직렬화
+Ciphertext<DCRTPoly> deserialize_ciphertext(const char* data, size_t size);
+
+// Unix 도메인 소켓. listen_unix 는 연결이 거부되는 (남은) 소켓 파일만 지우고, 살아 있는 서버가 있으면 예외
+int listen_unix(const std::string& path);
+int connect_unix(const std::string& path);
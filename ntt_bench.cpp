@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "he_ntt.h"
+#include "he_util.h"
+
+// 사용법: ./ntt_bench [--moduli 65537,7340033,593779228673] [--sizes 16,32,...,65536] [--max-naive 8192] [--iters 5]
+// 평문 다항식 곱 검증기(링 차원 n 의 negacyclic 곱)를 O(n^2) 이중 루프와 NTT 커널(스칼라 / AVX2 / AVX-512)로 비교한다.
+// 이중 루프는 n <= --max-naive 까지만 실측하고, 그 위는 마지막 실측값에서 n^2 으로 추정한다 (~ 표시, 실측값이 없으면 n/a).
+int main(int argc, char* argv[]) {
+    const auto moduli = arg_int_list(argc, argv, "--moduli", "65537,7340033,593779228673");
+    const auto sizes = arg_int_list(argc, argv, "--sizes", "16,32,64,128,256,512,1024,2048,4096,8192,16384,32768,65536");
+    const size_t max_naive = arg_int(argc, argv, "--max-naive", 8192);
+    const size_t iters = std::max<int64_t>(1, arg_int(argc, argv, "--iters", 5));
+
+    const std::vector<NttKernel> kernels = {NttKernel::Scalar, NttKernel::Avx2, NttKernel::Avx512};
+    std::cout << "지원 커널:";
+    for (auto kernel : kernels) {
+        if (ntt_kernel_supported(kernel)) std::cout << " " << ntt_kernel_name(kernel);
+    }
+    std::cout << " (기본 " << ntt_kernel_name(best_ntt_kernel()) << ")" << std::endl;
+
+    std::mt19937_64 rng(1234);
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "t\tn\t경로\t이중루프(ms)";
+    for (auto kernel : kernels) std::cout << "\t" << ntt_kernel_name(kernel) << "(ms)";
+    std::cout << "\t속도비\t일치" << std::endl;
+
+    for (int64_t t : moduli) {
+        std::uniform_int_distribution<int64_t> dist(-(t / 2), t / 2);
+        double naive_ns_per_pair = 0.0;
+        for (int64_t n_signed : sizes) {
+            const size_t n = static_cast<size_t>(n_signed);
+            std::vector<int64_t> a(n), b(n);
+            for (size_t i = 0; i < n; i++) {
+                a[i] = dist(rng);
+                b[i] = dist(rng);
+            }
+
+            // 링 차원 n: 암호문 곱 결과 검증과 같은 negacyclic 곱
+            std::vector<int64_t> expected;
+            double naive_ms = 0.0;
+            const bool estimated = n > max_naive;
+            if (!estimated) {
+                auto start = Clock::now();
+                expected = negacyclic_multiply(a, b, t, n);
+                naive_ms = elapsed_ms(start, Clock::now());
+                naive_ns_per_pair = naive_ms * 1e6 / (static_cast<double>(n) * n);
+            } else {
+                naive_ms = naive_ns_per_pair * static_cast<double>(n) * n / 1e6;
+            }
+
+            ntt_multiply(a, b, t, n);  // 표 생성 (캐시) 워밍업
+            // 아직 실측한 크기가 없으면 추정할 쌍당 비용이 없음
+            const bool have_naive = !estimated || naive_ns_per_pair > 0.0;
+            std::cout << t << "\t" << n << "\t" << ntt_path(n, n, t) << "\t";
+            if (have_naive) {
+                std::cout << (estimated ? "~" : "") << naive_ms;
+            } else {
+                std::cout << "n/a";
+            }
+            double best_ms = 0.0;
+            bool match = true;
+            std::vector<int64_t> reference;
+            for (auto kernel : kernels) {
+                if (!ntt_kernel_supported(kernel)) {
+                    std::cout << "\t-";
+                    continue;
+                }
+                std::vector<int64_t> result;
+                const double ms = median_ms(iters, [&] { result = ntt_multiply(a, b, t, n, kernel); });
+                if (reference.empty()) reference = result;
+                match = match && result == reference && (expected.empty() || result == expected);
+                best_ms = best_ms == 0.0 ? ms : std::min(best_ms, ms);
+                std::cout << "\t" << ms;
+            }
+            std::cout << "\t";
+            if (have_naive && best_ms > 0.0) {
+                std::cout << std::setprecision(1) << naive_ms / best_ms << "x" << std::setprecision(3);
+            } else {
+                std::cout << "n/a";
+            }
+            std::cout << "\t" << (match ? "O" : "X") << (expected.empty() ? " (커널 간)" : "")
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -1,61 +1,53 @@
-#define PROFILE
 #include <openfhe/pke/openfhe.h>
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <random>
 #include <vector>
 
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_ntt.h"
+#include "he_polymul.h"
+
 using namespace lbcrypto;
 
-// 다항식 곱셈 함수 (직접 구현)
-std::vector<int64_t> polynomial_multiply(const std::vector<int64_t>& poly1, 
-                                        const std::vector<int64_t>& poly2,
-                                        int64_t mod) {
-    int n1 = poly1.size();
-    int n2 = poly2.size();
-    int result_size = n1 + n2 - 1;
-    std::vector<int64_t> result(result_size, 0);
-    
-    for (int i = 0; i < n1; i++) {
-        for (int j = 0; j < n2; j++) {
-            result[i + j] = (result[i + j] + poly1[i] * poly2[j]) % mod;
-        }
-    }
-    
-    return result;
-}
+// 사용법: ./polynomial_mult_test [--ring 8192] [--t 65537] [--sizes 2,4,...,4096] [--max-naive 32] [--iters 3]
+// 1) (2x + 3) * (6x + 5) 예제를 계수 인코딩(EvalMult 1회)과 항별 곱셈(EvalMult 4회)으로 계산
+// 2) 계수 개수 n 을 늘려가며 두 방식의 지연을 비교 (항별 곱셈은 n <= --max-naive 까지만 실측, 그 위는 n^2 배로 추정)
+int main(int argc, char* argv[]) {
+    const uint32_t ring_dim = arg_int(argc, argv, "--ring", 8192);
+    const int64_t mod = arg_int(argc, argv, "--t", 65537);
+    const auto sizes = arg_int_list(argc, argv, "--sizes", "2,4,8,16,32,64,128,256,512,1024,2048,4096");
+    const size_t max_naive = arg_int(argc, argv, "--max-naive", 32);
+    const size_t iters = std::max<int64_t>(1, arg_int(argc, argv, "--iters", 3));
 
-int main() {
-    // 파라미터 설정
+    // 파라미터 설정 (다항식 곱 한 번 = 곱셈 뎁스 1)
     CCParams<CryptoContextBGVRNS> parameters;
-    parameters.SetPlaintextModulus(65537);
-    parameters.SetMultiplicativeDepth(2);  // 다항식 곱셈을 위해 2로 설정
+    parameters.SetPlaintextModulus(mod);
+    parameters.SetMultiplicativeDepth(1);
     parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
-    parameters.SetRingDim(4096);
+    parameters.SetRingDim(ring_dim);
 
     std::cout << "========== 다항식 곱셈 테스트 시작 ==========\n";
-    
-    // 컨텍스트 생성
-    auto cc = GenCryptoContext(parameters);
-    cc->Enable(PKE);
-    cc->Enable(LEVELEDSHE);
-    cc->Enable(ADVANCEDSHE);
-
-    // 키 생성
-    auto keyPair = cc->KeyGen();
-    cc->EvalMultKeyGen(keyPair.secretKey);
-    cc->EvalRotateKeyGen(keyPair.secretKey, {1, 2, -1}); // 시프트 키 생성
+
+    // 컨텍스트 + 키 생성 (회전 키 불필요, 디스크 캐시가 있으면 로드)
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
 
     // 테스트 다항식 준비
-    // poly1 = 2x + 3, poly2 = 5x + 5
+    // poly1 = 2x + 3, poly2 = 6x + 5
     std::vector<int64_t> poly1 = {3, 2};  // 상수항, 1차항
     std::vector<int64_t> poly2 = {5, 6};  // 상수항, 1차항
-    
+
     std::cout << "다항식 1: " << poly1[1] << "x + " << poly1[0] << std::endl;
     std::cout << "다항식 2: " << poly2[1] << "x + " << poly2[0] << std::endl;
 
     // Plain 다항식 곱셈 결과
-    auto plain_result = polynomial_multiply(poly1, poly2, 65537);
+    auto plain_result = negacyclic_multiply(poly1, poly2, mod, cc->GetRingDimension());
     std::cout << "\n[Plain 다항식 곱셈 결과]" << std::endl;
     std::cout << "결과: ";
     for (size_t i = 0; i < plain_result.size(); i++) {
@@ -64,105 +56,87 @@ int main() {
     }
     std::cout << std::endl;
 
-    // 암호화
-    auto plaintext1 = cc->MakePackedPlaintext(poly1);
-    auto plaintext2 = cc->MakePackedPlaintext(poly2);
-    auto ciphertext1 = cc->Encrypt(keyPair.publicKey, plaintext1);
-    auto ciphertext2 = cc->Encrypt(keyPair.publicKey, plaintext2);
-
-    // 방법 1: 진정한 다항식 컨볼루션 곱셈
-    std::cout << "\n[방법 1: 진정한 다항식 컨볼루션 곱셈]" << std::endl;
-    
-    // 다항식 곱셈: (2x + 3) * (5x + 5) = 10x² + 25x + 15
-    
-    // 각 항을 개별적으로 계산
-    // 1. 상수항: 3 * 5 = 15
-    auto ct_const_const = cc->EvalMult(
-        cc->EvalMult(ciphertext1, cc->MakePackedPlaintext({1, 0})), // 3
-        cc->EvalMult(ciphertext2, cc->MakePackedPlaintext({1, 0}))  // 5
-    );
-    
-    // 2. 1차항: 3*5x + 2x*5 = 15x + 10x = 25x
-    // 3*5x 계산
-    auto ct_const_linear = cc->EvalMult(
-        cc->EvalMult(ciphertext1, cc->MakePackedPlaintext({1, 0})), // 3
-        cc->EvalMult(ciphertext2, cc->MakePackedPlaintext({0, 1}))  // 5x
-    );
-    
-    // 2x*5 계산
-    auto ct_linear_const = cc->EvalMult(
-        cc->EvalMult(ciphertext1, cc->MakePackedPlaintext({0, 1})), // 2x
-        cc->EvalMult(ciphertext2, cc->MakePackedPlaintext({1, 0}))  // 5
-    );
-    
-    // 1차항 합산
-    auto ct_linear_sum = cc->EvalAdd(ct_const_linear, ct_linear_const);
-    
-    // 3. 2차항: 2x * 5x = 10x²
-    auto ct_linear_linear = cc->EvalMult(
-        cc->EvalMult(ciphertext1, cc->MakePackedPlaintext({0, 1})), // 2x
-        cc->EvalMult(ciphertext2, cc->MakePackedPlaintext({0, 1}))  // 5x
-    );
-    
-    // 복호화
-    Plaintext dec_const_const, dec_linear_sum, dec_linear_linear;
-    cc->Decrypt(keyPair.secretKey, ct_const_const, &dec_const_const);
-    cc->Decrypt(keyPair.secretKey, ct_linear_sum, &dec_linear_sum);
-    cc->Decrypt(keyPair.secretKey, ct_linear_linear, &dec_linear_linear);
-    
-    std::vector<int64_t> result_const_const = dec_const_const->GetPackedValue();
-    std::vector<int64_t> result_linear_sum = dec_linear_sum->GetPackedValue();
-    std::vector<int64_t> result_linear_linear = dec_linear_linear->GetPackedValue();
-    
-    // centered modular 보정
-    int64_t mod = 65537;
-    for (int i = 0; i < 2; i++) {
-        if (result_const_const[i] > mod/2) result_const_const[i] -= mod;
-        if (result_linear_sum[i] > mod/2) result_linear_sum[i] -= mod;
-        if (result_linear_linear[i] > mod/2) result_linear_linear[i] -= mod;
-    }
-    
-    std::cout << "상수항 (x⁰): " << result_const_const[0] << std::endl;
-    std::cout << "1차항 (x¹): " << result_linear_sum[0] << std::endl;
-    std::cout << "2차항 (x²): " << result_linear_linear[0] << std::endl;
-    
-    // 최종 결과 조합
-    std::vector<int64_t> final_result = {result_const_const[0], result_linear_sum[0], result_linear_linear[0]};
-    std::cout << "암호문끼리 곱셈 결과: [" << final_result[0] << ", " << final_result[1] << ", " << final_result[2] << "]" << std::endl;
-
-    // 방법 2: 단순 암호문 곱셈 (요소별 곱셈)
-    std::cout << "\n[방법 2: 단순 암호문 곱셈 (요소별)]" << std::endl;
-    auto ct_simple_mult = cc->EvalMult(ciphertext1, ciphertext2);
-    
-    Plaintext dec_simple;
-    cc->Decrypt(keyPair.secretKey, ct_simple_mult, &dec_simple);
-    std::vector<int64_t> result_simple = dec_simple->GetPackedValue();
-    
-    // centered modular 보정
-    for (size_t i = 0; i < result_simple.size(); i++) {
-        if (result_simple[i] > mod/2) result_simple[i] -= mod;
-    }
-    
-    std::cout << "요소별 곱셈 결과: [" << result_simple[0] << ", " << result_simple[1] << "]" << std::endl;
+    // 방법 1: 계수 인코딩 - 평문 다항식 곱이 곧 다항식 곱이므로 EvalMult 한 번
+    std::cout << "\n[방법 1: 계수 인코딩 (EvalMult 1회)]" << std::endl;
+    auto ct_poly = multiply_polys(cc, encrypt_coeffs(cc, keyPair.publicKey, poly1), encrypt_coeffs(cc, keyPair.publicKey, poly2));
+    auto coef_result = decrypt_coeffs(cc, keyPair.secretKey, ct_poly, plain_result.size());
+    std::cout << "결과: [" << coef_result[0] << ", " << coef_result[1] << ", " << coef_result[2] << "]" << std::endl;
+
+    // 방법 2: 항별 곱셈 - 계수마다 암호문 하나, c_k = sum_{i+j=k} a_i * b_j
+    std::cout << "\n[방법 2: 항별 곱셈 (EvalMult " << poly1.size() * poly2.size() << "회)]" << std::endl;
+    auto terms = multiply_term_by_term(cc, encrypt_terms(cc, keyPair.publicKey, poly1), encrypt_terms(cc, keyPair.publicKey, poly2));
+    auto term_result = decrypt_terms(cc, keyPair.secretKey, terms);
+    std::cout << "결과: [" << term_result[0] << ", " << term_result[1] << ", " << term_result[2] << "]" << std::endl;
 
     // 결과 비교
     std::cout << "\n[결과 비교]" << std::endl;
     std::cout << "Plain 다항식 곱셈: [" << plain_result[0] << ", " << plain_result[1] << ", " << plain_result[2] << "]" << std::endl;
-    std::cout << "암호문끼리 곱셈: [" << final_result[0] << ", " << final_result[1] << ", " << final_result[2] << "]" << std::endl;
-    std::cout << "요소별 곱셈: [" << result_simple[0] << ", " << result_simple[1] << "]" << std::endl;
-    std::cout << "예상 결과: [15, 25, 10]" << std::endl;
-    
-    // 정확성 검증
-    bool is_correct = (final_result[0] == plain_result[0] && 
-                      final_result[1] == plain_result[1] && 
-                      final_result[2] == plain_result[2]);
-    std::cout << "\n암호문끼리 곱셈 정확성: " << (is_correct ? "O" : "X") << std::endl;
-    
+    std::cout << "예상 결과: [15, 28, 12]" << std::endl;
+    std::cout << "계수 인코딩 정확성: " << (coef_result == plain_result ? "O" : "X") << std::endl;
+    std::cout << "항별 곱셈 정확성: " << (term_result == plain_result ? "O" : "X") << std::endl;
+
     // 계산 과정 설명
     std::cout << "\n[계산 과정]" << std::endl;
-    std::cout << "(2x + 3) * (5x + 5) = 2x*5x + 2x*5 + 3*5x + 3*5" << std::endl;
-    std::cout << "                    = 10x² + 10x + 15x + 15" << std::endl;
-    std::cout << "                    = 10x² + 25x + 15" << std::endl;
+    std::cout << "(2x + 3) * (6x + 5) = 2x*6x + 2x*5 + 3*6x + 3*5" << std::endl;
+    std::cout << "                    = 12x² + 10x + 18x + 15" << std::endl;
+    std::cout << "                    = 12x² + 28x + 15" << std::endl;
+
+    // ====== 크기별 벤치마크 ======
+    // 차수 합이 링 차원 이상이면 X^N = -1 로 감기는 negacyclic 곱이 되며, 평문 기준(NTT)도 같은 규칙으로 계산한다
+    std::mt19937_64 rng(1234);
+    std::uniform_int_distribution<int64_t> dist(-(mod / 2), mod / 2);
+    std::cout << "\n[크기별 비교: 링 차원 " << cc->GetRingDimension() << ", t = " << mod << "]" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "n\t계수:암호화(ms)\t계수:곱(ms)\t계수:복호화(ms)\t항별:EvalMult수\t항별:곱(ms)\t속도비\t정확성" << std::endl;
+    double naive_ms_per_mult = 0.0;
+    for (int64_t n_signed : sizes) {
+        const size_t n = static_cast<size_t>(n_signed);
+        if (n == 0 || n > cc->GetRingDimension()) continue;
+        std::vector<int64_t> a(n), b(n);
+        for (size_t i = 0; i < n; i++) {
+            a[i] = dist(rng);
+            b[i] = dist(rng);
+        }
+        const auto expected = ntt_multiply(a, b, mod, cc->GetRingDimension());  // O(n log n) 평문 기준
+
+        Ciphertext<DCRTPoly> ct_a, ct_b, ct_c;
+        const double encrypt_ms = median_ms(iters, [&] {
+            ct_a = encrypt_coeffs(cc, keyPair.publicKey, a);
+            ct_b = encrypt_coeffs(cc, keyPair.publicKey, b);
+        });
+        const double mult_ms = median_ms(iters, [&] { ct_c = multiply_polys(cc, ct_a, ct_b); });
+        std::vector<int64_t> result;
+        const double decrypt_ms = median_ms(iters, [&] { result = decrypt_coeffs(cc, keyPair.secretKey, ct_c, expected.size()); });
+        bool correct = result == expected;
+
+        // 항별 곱셈: 작은 n 만 실측하고, 그 위는 실측한 EvalMult(+EvalAdd) 1회 비용 x n^2 로 추정
+        double naive_ms = 0.0;
+        bool estimated = n > max_naive;
+        if (!estimated) {
+            auto term_a = encrypt_terms(cc, keyPair.publicKey, a);
+            auto term_b = encrypt_terms(cc, keyPair.publicKey, b);
+            std::vector<Ciphertext<DCRTPoly>> product;
+            auto start = Clock::now();
+            product = multiply_term_by_term(cc, term_a, term_b);
+            naive_ms = elapsed_ms(start, Clock::now());
+            naive_ms_per_mult = naive_ms / (n * n);
+            correct = correct && decrypt_terms(cc, keyPair.secretKey, product) == negacyclic_multiply(a, b, mod, 2 * n);
+        } else {
+            naive_ms = naive_ms_per_mult * n * n;
+        }
+
+        std::cout << n << "\t" << encrypt_ms << "\t" << mult_ms << "\t" << decrypt_ms << "\t" << n * n << "\t";
+        if (estimated && naive_ms_per_mult <= 0.0) {
+            // 아직 실측한 크기가 없어 추정할 1회 비용이 없음
+            std::cout << "n/a\tn/a";
+        } else {
+            std::cout << (estimated ? "~" : "") << naive_ms << "\t" << std::setprecision(1) << naive_ms / mult_ms << "x"
+                      << std::setprecision(3);
+        }
+        std::cout << "\t" << (correct ? "O" : "X") << std::endl;
+    }
+    std::cout << "(~ 는 항별 곱셈 추정값, n/a 는 --max-naive 이하 크기가 없어 추정 불가, 계수 인코딩은 크기와 무관하게 EvalMult 1회)"
+              << std::endl;
 
     return 0;
-} 
\ No newline at end of file
+}
@@ -0,0 +1,123 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <map>
+
+#include "he_approx.h"
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_approx [--x-max-deg 180] [--t 593779228673] [--ring 16384] [--max-degree 7] [--no-encrypt]
+// 현재 테일러 구현(3차/5차, s = 50)과 테일러/체비쇼프/미니맥스 홀수 근사를 같은 PlaintextModulus 에서 정수화해
+// 최대 오차(모든 정수 입력 모의, 입력 양자화 포함), 10도 격자 오차, 암호문 평가 지연을 비교한다.
+namespace {
+
+struct ApproxRow {
+    std::string method;
+    size_t degree = 0;
+    double approx_error = 0.0;  // 실수 계수 근사 오차 (정수화 이전)
+    IntegerPlan plan;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const double x_max = arg_double(argc, argv, "--x-max-deg", 180.0) * M_PI / 180.0;
+    const int64_t PlaintextModulus = arg_int(argc, argv, "--t", 593779228673);
+    const uint32_t RingDim = arg_int(argc, argv, "--ring", 16384);
+    const size_t max_degree = arg_int(argc, argv, "--max-degree", 7);
+    const bool encrypt = !arg_flag(argc, argv, "--no-encrypt");
+    const auto f = [](double x) { return std::sin(x); };
+
+    // ====== 근사 후보 ======
+    std::vector<ApproxRow> rows;
+    for (size_t degree : {3, 5}) {
+        int64_t denom = degree == 3 ? 6 : 120;
+        ApproxRow row;
+        row.method = "테일러(현재)";
+        row.degree = degree;
+        row.approx_error = odd_poly_error(f, taylor_sin_odd(degree), x_max);
+        row.plan = simulate_integer_pipeline(make_taylor_sin(degree, 50, denom), denom, x_max);
+        rows.push_back(row);
+    }
+    for (size_t degree = 3; degree <= max_degree; degree += 2) {
+        const std::vector<std::pair<std::string, std::vector<double>>> fits = {
+            {"테일러", taylor_sin_odd(degree)},
+            {"체비쇼프", fit_odd_chebyshev(f, degree, x_max)},
+            {"미니맥스", fit_odd_minimax(f, degree, x_max)},
+        };
+        for (const auto& fit : fits) {
+            ApproxRow row;
+            row.method = fit.first;
+            row.degree = degree;
+            row.approx_error = odd_poly_error(f, fit.second, x_max);
+            row.plan = best_quantization(fit.second, x_max, PlaintextModulus);
+            rows.push_back(row);
+        }
+    }
+
+    // ====== 10도 격자 입력 ======
+    const int deg_limit = static_cast<int>(std::floor(x_max * 180.0 / M_PI + 1e-9));
+    std::vector<int> degs;
+    for (int deg = -deg_limit / 10 * 10; deg <= deg_limit; deg += 10) degs.push_back(deg);
+
+    std::map<uint32_t, HeContext> contexts;
+    std::cout << std::fixed;
+    std::cout << "PlaintextModulus: " << PlaintextModulus << ", 입력 범위: |x| <= " << std::setprecision(4) << x_max << " rad" << std::endl;
+    std::cout << "\n방법\t차수\t뎁스\ts\t출력스케일(log2)\t근사오차\t최대오차(모의)\t격자오차\t평가(ms)\t불일치" << std::endl;
+    for (const auto& row : rows) {
+        const ScaledPolynomial& poly = row.plan.poly;
+        const uint32_t depth = required_depth(poly.degree());
+
+        std::vector<int64_t> inputs;
+        double grid_error = 0.0;
+        for (int deg : degs) {
+            double x = deg * M_PI / 180.0;
+            int64_t x_scaled = static_cast<int64_t>(std::round(poly.s * x));
+            inputs.push_back(x_scaled);
+            double y = static_cast<double>(eval_scaled_plain(poly, x_scaled, PlaintextModulus)) / poly.scale;
+            grid_error = std::max(grid_error, std::abs(y - std::sin(x)));
+        }
+
+        double eval_ms = -1.0;
+        size_t mismatch = 0;
+        if (encrypt) {
+            if (!contexts.count(depth)) {
+                CCParams<CryptoContextBGVRNS> parameters;
+                parameters.SetPlaintextModulus(PlaintextModulus);
+                parameters.SetMultiplicativeDepth(depth);
+                parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+                parameters.SetRingDim(RingDim);
+                contexts.emplace(depth, load_or_create_context(parameters));
+            }
+            const auto& he = contexts.at(depth);
+
+            auto ct_x = encrypt_batch(he.cc, he.keyPair.publicKey, inputs);
+            PolyEvaluator evaluator(he.cc);
+            std::vector<Ciphertext<DCRTPoly>> ct_y;
+            auto start = Clock::now();
+            for (const auto& ct : ct_x) ct_y.push_back(evaluator.evaluate(ct, poly));
+            eval_ms = elapsed_ms(start, Clock::now());
+
+            auto outputs = decrypt_batch(he.cc, he.keyPair.secretKey, ct_y, inputs.size());
+            for (size_t i = 0; i < inputs.size(); i++) {
+                if (outputs[i] != eval_scaled_plain(poly, inputs[i], PlaintextModulus)) mismatch++;
+            }
+        }
+
+        std::cout << row.method << "\t" << row.degree << "\t" << depth << "\t" << poly.s
+                  << "\t" << std::setprecision(1) << std::log2(poly.scale)
+                  << "\t" << std::setprecision(6) << row.approx_error << "\t" << row.plan.max_error
+                  << "\t" << grid_error << "\t" << std::setprecision(2);
+        if (eval_ms >= 0.0) std::cout << eval_ms << "\t" << mismatch;
+        else std::cout << "-\t-";
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+
+#include "he_backend.h"
+#include "he_common.h"
+#include "he_pipeline.h"
+#include "he_tune.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_backends [--schemes bgv,ckks] [--degrees 5,7,13] [--security notset,128]
+//                       [--slots 8192] [--ring 16384] [--x-max-deg 180] [--t 593779228673] [--iters 5]
+// 같은 슬롯 수의 입력(-x_max ~ x_max 균등 분할)을 BGV 와 CKKS 백엔드로 평가해
+// 정확도, 암호화/평가/복호화 지연, 암호문 크기, 링 차원, 보안 수준을 나란히 출력한다.
+int main(int argc, char* argv[]) {
+    const auto schemes = arg_str_list(argc, argv, "--schemes", "bgv,ckks");
+    const auto degrees = arg_int_list(argc, argv, "--degrees", "5,7,13");
+    const auto securities = arg_str_list(argc, argv, "--security", "notset,128");
+    const size_t iters = arg_int(argc, argv, "--iters", 5);
+
+    BackendConfig base;
+    base.slots = arg_int(argc, argv, "--slots", 8192);
+    base.ring_dim = arg_int(argc, argv, "--ring", 16384);
+    base.x_max = arg_double(argc, argv, "--x-max-deg", 180.0) * M_PI / 180.0;
+    base.plaintext_modulus = arg_int(argc, argv, "--t", 593779228673);
+
+    std::vector<double> inputs(base.slots);
+    for (size_t i = 0; i < inputs.size(); i++) {
+        inputs[i] = -base.x_max + 2.0 * base.x_max * i / std::max<size_t>(1, inputs.size() - 1);
+    }
+
+    std::cout << std::fixed;
+    std::cout << "스킴\t차수\t보안\t링차원\t슬롯\t뎁스\t모델오차\t최대오차\t암호화(ms)\t평가p50(ms)\t복호화(ms)\t"
+                 "입력암호문(B)\t결과암호문(B)\t상태" << std::endl;
+    for (const auto& security : securities) {
+        for (int64_t degree : degrees) {
+            for (const auto& scheme : schemes) {
+                BackendConfig config = base;
+                config.degree = degree;
+                config.security = parse_security(security);
+                std::cout << scheme << "\t" << degree << "\t" << security_name(config.security) << "\t";
+
+                try {
+                    auto backend = make_sin_backend(scheme, config);
+
+                    auto start = Clock::now();
+                    auto ct_x = backend->encrypt(inputs);
+                    double encrypt_ms = elapsed_ms(start, Clock::now());
+
+                    Ciphertext<DCRTPoly> ct_y;
+                    std::vector<double> eval_samples;
+                    for (size_t i = 0; i < std::max<size_t>(1, iters); i++) {
+                        start = Clock::now();
+                        ct_y = backend->evaluate(ct_x);
+                        eval_samples.push_back(elapsed_ms(start, Clock::now()));
+                    }
+                    std::sort(eval_samples.begin(), eval_samples.end());
+
+                    start = Clock::now();
+                    auto outputs = backend->decrypt(ct_y, inputs.size());
+                    double decrypt_ms = elapsed_ms(start, Clock::now());
+
+                    double max_error = 0.0;
+                    for (size_t i = 0; i < inputs.size(); i++) {
+                        max_error = std::max(max_error, std::abs(outputs[i] - std::sin(inputs[i])));
+                    }
+
+                    std::cout << backend->ring_dim() << "\t" << backend->slots() << "\t" << backend->depth()
+                              << "\t" << std::setprecision(6) << backend->model_error() << "\t" << max_error
+                              << "\t" << std::setprecision(2) << encrypt_ms << "\t" << percentile(eval_samples, 50.0)
+                              << "\t" << decrypt_ms << "\t" << ciphertext_bytes(ct_x) << "\t" << ciphertext_bytes(ct_y)
+                              << "\tok" << std::endl;
+                } catch (const std::exception& e) {
+                    std::string message = e.what();
+                    std::replace(message.begin(), message.end(), '\n', ' ');
+                    std::cout << "-\t-\t-\t-\t-\t-\t-\t-\t-\t-\t불가: " << message << std::endl;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
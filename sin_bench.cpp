@@ -0,0 +1,364 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "he_common.h"
+#include "he_pipeline.h"
+#include "he_poly_eval.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_bench [--rings 4096,8192,16384] [--degrees 3,5,7] [--moduli 65537,7340033,593779228673]
+//                    [--security notset,128] [--depth-slack 0] [--iters 10] [--warmup 2]
+//                    [--csv sin_bench.csv] [--json sin_bench.json]
+// 모든 조합에 대해 컨텍스트 생성, 키 생성, 암호화, EvalMult(암호문x암호문 / 암호문x평문), 다항식 평가, 복호화 시간을
+// 워밍업 후 반복 측정하고 중앙값/p90/p99, 암호문 크기, 최대 RSS 를 CSV/JSON 으로 기록한다.
+// EvalMult(암호문x암호문) 는 뎁스만큼 제곱을 이어 가며 단계마다 따로 잰다 (뒤 단계일수록 타워가 줄어든다).
+// 조합마다 fork 한 자식 프로세스에서 측정해 최대 RSS 가 앞 조합의 값에 묻히지 않게 한다.
+
+namespace {
+
+struct Summary {
+    double median = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+};
+
+struct BenchResult {
+    uint32_t ring_dim = 0;
+    size_t degree = 0;
+    uint32_t depth = 0;
+    int64_t plaintext_modulus = 0;
+    std::string security;
+    std::string status = "ok";
+    Summary context_ms, keygen_ms, encrypt_ms, mult_ct_ms, mult_pt_ms, eval_ms, decrypt_ms, decrypt_full_ms;
+    std::vector<Summary> mult_chain_ms;  // 곱셈 체인 단계별 EvalMult (암호문x암호문)
+    size_t fresh_ct_bytes = 0;
+    size_t result_ct_bytes = 0;       // 최소 타워로 압축한 결과
+    size_t result_full_ct_bytes = 0;  // 압축 전 결과
+    size_t result_towers = 0;
+    size_t result_full_towers = 0;
+    long peak_rss_kb = 0;
+    bool correct = false;
+};
+
+Summary summarize(std::vector<double> samples) {
+    Summary summary;
+    std::sort(samples.begin(), samples.end());
+    summary.median = percentile(samples, 50.0);
+    summary.p90 = percentile(samples, 90.0);
+    summary.p99 = percentile(samples, 99.0);
+    return summary;
+}
+
+// warmup 회 버린 뒤 iters 회 측정
+Summary measure(size_t warmup, size_t iters, const std::function<void()>& fn) {
+    for (size_t i = 0; i < warmup; i++) fn();
+    std::vector<double> samples;
+    for (size_t i = 0; i < iters; i++) {
+        auto start = Clock::now();
+        fn();
+        samples.push_back(elapsed_ms(start, Clock::now()));
+    }
+    return summarize(samples);
+}
+
+CryptoContext<DCRTPoly> make_context(const CCParams<CryptoContextBGVRNS>& parameters) {
+    // 팩토리에 남은 같은 파라미터의 컨텍스트를 재사용하지 않도록 비운 뒤 생성
+    CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+    auto cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    cc->Enable(ADVANCEDSHE);
+    return cc;
+}
+
+BenchResult run_config(uint32_t ring_dim, size_t degree, uint32_t depth, int64_t t,
+                       const std::string& security, size_t warmup, size_t iters) {
+    BenchResult result;
+    result.ring_dim = ring_dim;
+    result.degree = degree;
+    result.depth = depth;
+    result.plaintext_modulus = t;
+    result.security = security;
+
+    // 180도 입력까지 결과가 t/2 안에 들어가는 가장 큰 s
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+    int64_t s = 50;
+    for (; s > 1; s--) {
+        if (std::pow(static_cast<long double>(s), degree - 1) * denom > 4e18L) continue;
+        if (output_fits(make_taylor_sin(degree, s, denom), std::llround(s * M_PI), t)) break;
+    }
+    const ScaledPolynomial poly = make_taylor_sin(degree, s, denom);
+
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(t);
+    parameters.SetMultiplicativeDepth(depth);
+    parameters.SetSecurityLevel(security == "128" ? SecurityLevel::HEStd_128_classic : SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(ring_dim);
+
+    try {
+        CryptoContext<DCRTPoly> cc;
+        result.context_ms = measure(warmup, iters, [&] { cc = make_context(parameters); });
+
+        KeyPair<DCRTPoly> keyPair;
+        result.keygen_ms = measure(warmup, iters, [&] {
+            cc->ClearEvalMultKeys();
+            keyPair = cc->KeyGen();
+            cc->EvalMultKeyGen(keyPair.secretKey);
+        });
+
+        std::vector<int64_t> inputs(slot_count(cc));
+        for (size_t i = 0; i < inputs.size(); i++) {
+            int deg = -180 + 10 * static_cast<int>(i % 37);
+            inputs[i] = static_cast<int64_t>(std::round(s * deg * M_PI / 180.0));
+        }
+        auto p_x = cc->MakePackedPlaintext(inputs);
+
+        Ciphertext<DCRTPoly> ct_x;
+        result.encrypt_ms = measure(warmup, iters, [&] { ct_x = cc->Encrypt(keyPair.publicKey, p_x); });
+        result.fresh_ct_bytes = ciphertext_bytes(ct_x);
+
+        // 곱셈 체인: 제곱을 뎁스만큼 이어 가며 단계마다 측정 (입력의 mod reduce 가 각 단계 비용에 포함됨)
+        // mult_ct 는 첫 단계 (새 암호문끼리의 곱)
+        Ciphertext<DCRTPoly> ct_level = ct_x;
+        for (uint32_t level = 0; level < depth; level++) {
+            result.mult_chain_ms.push_back(measure(warmup, iters, [&] { cc->EvalMult(ct_level, ct_level); }));
+            ct_level = cc->EvalMult(ct_level, ct_level);
+        }
+        result.mult_ct_ms = result.mult_chain_ms.front();
+        auto p_coeff = cc->MakePackedPlaintext(std::vector<int64_t>(inputs.size(), poly.coeffs[1]));
+        result.mult_pt_ms = measure(warmup, iters, [&] { cc->EvalMult(ct_x, p_coeff); });
+
+        PolyEvaluator evaluator(cc);
+        Ciphertext<DCRTPoly> ct_y;
+        result.eval_ms = measure(warmup, iters, [&] { ct_y = evaluator.evaluate(ct_x, poly); });
+        result.result_ct_bytes = ciphertext_bytes(ct_y);
+        result.result_towers = tower_count(ct_y);
+
+        // 압축 전 결과와 비교 (타워 수, 크기, 복호화 시간)
+        evaluator.set_compaction(false);
+        auto ct_full = evaluator.evaluate(ct_x, poly);
+        result.result_full_ct_bytes = ciphertext_bytes(ct_full);
+        result.result_full_towers = tower_count(ct_full);
+
+        Plaintext p_y;
+        result.decrypt_full_ms = measure(warmup, iters, [&] { cc->Decrypt(keyPair.secretKey, ct_full, &p_y); });
+        result.decrypt_ms = measure(warmup, iters, [&] { cc->Decrypt(keyPair.secretKey, ct_y, &p_y); });
+        p_y->SetLength(inputs.size());
+        result.correct = true;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (centered_mod(p_y->GetPackedValue()[i], t) != eval_scaled_plain(poly, inputs[i], t)) {
+                result.correct = false;
+                break;
+            }
+        }
+    } catch (const std::exception& e) {
+        result.status = e.what();
+        std::replace(result.status.begin(), result.status.end(), '\n', ' ');
+        std::replace(result.status.begin(), result.status.end(), '"', '\'');
+        std::replace(result.status.begin(), result.status.end(), ',', ';');
+    }
+    return result;
+}
+
+// ====== 조합별 자식 프로세스 ======
+// 측정값을 자식 -> 부모 파이프로 넘기는 텍스트 형식 (status 는 마지막 줄 전체)
+std::string encode_result(const BenchResult& r) {
+    std::ostringstream os;
+    os << std::setprecision(17);
+    for (const Summary* s : {&r.context_ms, &r.keygen_ms, &r.encrypt_ms, &r.mult_ct_ms, &r.mult_pt_ms, &r.eval_ms,
+                             &r.decrypt_ms, &r.decrypt_full_ms}) {
+        os << s->median << " " << s->p90 << " " << s->p99 << " ";
+    }
+    os << r.mult_chain_ms.size();
+    for (const auto& s : r.mult_chain_ms) os << " " << s.median << " " << s.p90 << " " << s.p99;
+    os << " " << r.fresh_ct_bytes << " " << r.result_ct_bytes << " " << r.result_full_ct_bytes << " "
+       << r.result_towers << " " << r.result_full_towers << " " << r.correct << "\n" << r.status;
+    return os.str();
+}
+
+bool decode_result(const std::string& encoded, BenchResult& r) {
+    std::istringstream is(encoded);
+    for (Summary* s : {&r.context_ms, &r.keygen_ms, &r.encrypt_ms, &r.mult_ct_ms, &r.mult_pt_ms, &r.eval_ms,
+                       &r.decrypt_ms, &r.decrypt_full_ms}) {
+        is >> s->median >> s->p90 >> s->p99;
+    }
+    size_t steps = 0;
+    is >> steps;
+    r.mult_chain_ms.resize(is ? steps : 0);
+    for (auto& s : r.mult_chain_ms) is >> s.median >> s.p90 >> s.p99;
+    is >> r.fresh_ct_bytes >> r.result_ct_bytes >> r.result_full_ct_bytes >> r.result_towers >> r.result_full_towers
+       >> r.correct;
+    if (!is) return false;
+    is.ignore(1);
+    std::getline(is, r.status);
+    return true;
+}
+
+// 조합 하나를 fork 한 자식에서 측정하고 wait4 의 자식 rusage 로 그 조합만의 최대 RSS 를 얻는다.
+// (한 프로세스의 ru_maxrss 는 단조 증가라 앞 조합의 최대값이 뒤 조합에 그대로 남는다)
+BenchResult run_config_isolated(uint32_t ring_dim, size_t degree, uint32_t depth, int64_t t,
+                                const std::string& security, size_t warmup, size_t iters) {
+    BenchResult result;
+    result.ring_dim = ring_dim;
+    result.degree = degree;
+    result.depth = depth;
+    result.plaintext_modulus = t;
+    result.security = security;
+
+    int fds[2];
+    if (::pipe(fds) != 0) {
+        result.status = "pipe 실패";
+        return result;
+    }
+    std::cout.flush();
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+        ::close(fds[0]);
+        ::close(fds[1]);
+        result.status = "fork 실패";
+        return result;
+    }
+    if (pid == 0) {
+        ::close(fds[0]);
+        const std::string encoded = encode_result(run_config(ring_dim, degree, depth, t, security, warmup, iters));
+        for (size_t offset = 0; offset < encoded.size();) {
+            const ssize_t n = ::write(fds[1], encoded.data() + offset, encoded.size() - offset);
+            if (n <= 0) break;
+            offset += n;
+        }
+        ::close(fds[1]);
+        ::_exit(0);
+    }
+
+    // 파이프를 먼저 비워야 큰 결과를 쓰는 자식이 막히지 않는다
+    ::close(fds[1]);
+    std::string encoded;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = ::read(fds[0], buffer, sizeof(buffer))) > 0) encoded.append(buffer, n);
+    ::close(fds[0]);
+
+    int wait_status = 0;
+    struct rusage usage;
+    if (::wait4(pid, &wait_status, 0, &usage) == pid) result.peak_rss_kb = usage.ru_maxrss;
+    if (!decode_result(encoded, result)) {
+        result.status = WIFSIGNALED(wait_status) ? "자식 프로세스 시그널 " + std::to_string(WTERMSIG(wait_status))
+                                                 : std::string("자식 프로세스 결과 없음");
+    }
+    return result;
+}
+
+void write_csv(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream os(path);
+    os << "ring_dim,degree,depth,plaintext_modulus,security,status,correct";
+    for (const char* name : {"context", "keygen", "encrypt", "mult_ct", "mult_pt", "eval", "decrypt", "decrypt_full"}) {
+        os << "," << name << "_median_ms," << name << "_p90_ms," << name << "_p99_ms";
+    }
+    os << ",mult_chain_median_ms,fresh_ct_bytes,result_ct_bytes,result_full_ct_bytes,result_towers,result_full_towers,"
+          "peak_rss_kb\n";
+    for (const auto& r : results) {
+        os << r.ring_dim << "," << r.degree << "," << r.depth << "," << r.plaintext_modulus << ","
+           << r.security << "," << r.status << "," << (r.correct ? 1 : 0);
+        for (const Summary* s : {&r.context_ms, &r.keygen_ms, &r.encrypt_ms, &r.mult_ct_ms, &r.mult_pt_ms, &r.eval_ms,
+                                 &r.decrypt_ms, &r.decrypt_full_ms}) {
+            os << "," << s->median << "," << s->p90 << "," << s->p99;
+        }
+        // 체인 단계별 중앙값은 한 칸에 ';' 로 이어 쓴다
+        os << ",";
+        for (size_t i = 0; i < r.mult_chain_ms.size(); i++) os << (i ? ";" : "") << r.mult_chain_ms[i].median;
+        os << "," << r.fresh_ct_bytes << "," << r.result_ct_bytes << "," << r.result_full_ct_bytes
+           << "," << r.result_towers << "," << r.result_full_towers << "," << r.peak_rss_kb << "\n";
+    }
+}
+
+void write_json(const std::string& path, const std::vector<BenchResult>& results) {
+    auto summary_json = [](const Summary& s) {
+        std::ostringstream os;
+        os << "{\"median_ms\": " << s.median << ", \"p90_ms\": " << s.p90 << ", \"p99_ms\": " << s.p99 << "}";
+        return os.str();
+    };
+    std::ofstream os(path);
+    os << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        os << "  {\"ring_dim\": " << r.ring_dim << ", \"degree\": " << r.degree << ", \"depth\": " << r.depth
+           << ", \"plaintext_modulus\": " << r.plaintext_modulus << ", \"security\": \"" << r.security
+           << "\", \"status\": \"" << r.status << "\", \"correct\": " << (r.correct ? "true" : "false")
+           << ",\n   \"context\": " << summary_json(r.context_ms)
+           << ", \"keygen\": " << summary_json(r.keygen_ms)
+           << ",\n   \"encrypt\": " << summary_json(r.encrypt_ms)
+           << ", \"mult_ct\": " << summary_json(r.mult_ct_ms)
+           << ",\n   \"mult_chain\": [";
+        for (size_t k = 0; k < r.mult_chain_ms.size(); k++) os << (k ? ", " : "") << summary_json(r.mult_chain_ms[k]);
+        os << "],\n   \"mult_pt\": " << summary_json(r.mult_pt_ms)
+           << ", \"eval\": " << summary_json(r.eval_ms)
+           << ",\n   \"decrypt\": " << summary_json(r.decrypt_ms)
+           << ", \"decrypt_full\": " << summary_json(r.decrypt_full_ms)
+           << ",\n   \"result_towers\": " << r.result_towers << ", \"result_full_towers\": " << r.result_full_towers
+           << ", \"result_full_ct_bytes\": " << r.result_full_ct_bytes
+           << ", \"fresh_ct_bytes\": " << r.fresh_ct_bytes << ", \"result_ct_bytes\": " << r.result_ct_bytes
+           << ", \"peak_rss_kb\": " << r.peak_rss_kb << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    os << "]\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const auto rings = arg_int_list(argc, argv, "--rings", "4096,8192,16384");
+    const auto degrees = arg_int_list(argc, argv, "--degrees", "3,5,7");
+    const auto moduli = arg_int_list(argc, argv, "--moduli", "65537,7340033,593779228673");
+    const auto securities = arg_str_list(argc, argv, "--security", "notset,128");
+    const auto depth_slacks = arg_int_list(argc, argv, "--depth-slack", "0");
+    const size_t iters = arg_int(argc, argv, "--iters", 10);
+    const size_t warmup = arg_int(argc, argv, "--warmup", 2);
+    const std::string csv_path = arg_str(argc, argv, "--csv", "sin_bench.csv");
+    const std::string json_path = arg_str(argc, argv, "--json", "sin_bench.json");
+
+    std::vector<BenchResult> results;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "링차원\t차수\t뎁스\tPlaintextModulus\t보안\t컨텍스트(ms)\t키생성(ms)\t암호화(ms)\tct곱(ms)\tct곱 체인(단계별,ms)\tpt곱(ms)\t평가(ms)\t복호화(압축전->후,ms)\t타워(전->후)\t결과암호문(전->후,B)\t정확\t상태" << std::endl;
+    for (int64_t ring : rings) {
+        for (int64_t degree : degrees) {
+            for (int64_t slack : depth_slacks) {
+                for (int64_t t : moduli) {
+                    for (const auto& security : securities) {
+                        uint32_t depth = required_depth(degree) + static_cast<uint32_t>(slack);
+                        auto r = run_config_isolated(ring, degree, depth, t, security, warmup, iters);
+                        results.push_back(r);
+                        std::cout << r.ring_dim << "\t" << r.degree << "\t" << r.depth << "\t" << r.plaintext_modulus
+                                  << "\t" << r.security << "\t" << r.context_ms.median << "\t" << r.keygen_ms.median
+                                  << "\t" << r.encrypt_ms.median << "\t" << r.mult_ct_ms.median << "\t";
+                        for (size_t k = 0; k < r.mult_chain_ms.size(); k++) {
+                            std::cout << (k ? "/" : "") << r.mult_chain_ms[k].median;
+                        }
+                        std::cout << "\t" << r.mult_pt_ms.median
+                                  << "\t" << r.eval_ms.median << "\t" << r.decrypt_full_ms.median << "->" << r.decrypt_ms.median
+                                  << "\t" << r.result_full_towers << "->" << r.result_towers
+                                  << "\t" << r.result_full_ct_bytes << "->" << r.result_ct_bytes
+                                  << "\t" << (r.correct ? "O" : "X") << "\t" << r.status << std::endl;
+                    }
+                }
+            }
+        }
+    }
+
+    write_csv(csv_path, results);
+    write_json(json_path, results);
+    std::cout << "\nCSV: " << csv_path << ", JSON: " << json_path << std::endl;
+    return 0;
+}
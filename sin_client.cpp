@@ -0,0 +1,122 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_service.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_client --setup [--degree 5] [--server-keys server_keys]
+//        (키 생성/캐시 후 비밀키를 뺀 서버용 키 디렉토리를 내보내고 종료, 서버보다 먼저 한 번 실행)
+//        ./sin_client [--socket /tmp/enc_sin.sock] [--degree 5] [--requests 32] [--inflight 4] [--values-per-ct 0]
+// 같은 요청들을 (1) 이 프로세스 안에서 평가하고 (2) sin_server 에 보내 평가한 뒤
+// 처리량, 요청당 바이트, 직렬화/역직렬화 오버헤드를 비교한다. --values-per-ct 0 이면 슬롯 전체 사용.
+int main(int argc, char* argv[]) {
+    const std::string socket_path = arg_str(argc, argv, "--socket", "/tmp/enc_sin.sock");
+    const size_t degree = arg_int(argc, argv, "--degree", 5);
+    const size_t n_requests = std::max<int64_t>(1, arg_int(argc, argv, "--requests", 32));
+    const size_t inflight = std::max<int64_t>(1, arg_int(argc, argv, "--inflight", 4));
+    const ServiceSetup setup = make_service_setup(degree);
+    const ScaledPolynomial& poly = setup.poly;
+
+    auto he = load_or_create_context(setup.parameters);
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+    if (arg_flag(argc, argv, "--setup")) {
+        const std::string cache_dir = context_cache_dir_for(setup.parameters);
+        const std::string server_keys = arg_str(argc, argv, "--server-keys", kServerKeysDir);
+        if (cache_dir.empty() || !export_public_context(cache_dir, server_keys)) {
+            std::cerr << "서버용 키를 내보내지 못했습니다 (" << server_keys << ", 캐시: "
+                      << (cache_dir.empty() ? "비활성" : cache_dir) << ")" << std::endl;
+            return 1;
+        }
+        std::cout << "키 디렉토리 (비밀키 포함, 클라이언트 전용): " << cache_dir << std::endl;
+        std::cout << "서버용 키 디렉토리 (cc.bin, pk.bin, evalmult.bin): " << server_keys << std::endl;
+        return 0;
+    }
+
+    const int64_t t = static_cast<int64_t>(he.cc->GetEncodingParams()->GetPlaintextModulus());
+    size_t values_per_ct = arg_int(argc, argv, "--values-per-ct", 0);
+    if (values_per_ct == 0 || values_per_ct > slot_count(he.cc)) values_per_ct = slot_count(he.cc);
+
+    // ====== 요청: -180 ~ 180도, 10도 간격을 반복해 채운 암호문 ======
+    std::vector<int64_t> inputs(values_per_ct);
+    for (size_t i = 0; i < values_per_ct; i++) {
+        int deg = -180 + 10 * static_cast<int>(i % 37);
+        inputs[i] = static_cast<int64_t>(std::round(poly.s * deg * M_PI / 180.0));
+    }
+    std::vector<Ciphertext<DCRTPoly>> requests(n_requests);
+    auto start = Clock::now();
+    for (auto& ct : requests) ct = he.cc->Encrypt(he.keyPair.publicKey, he.cc->MakePackedPlaintext(inputs));
+    std::cout << "암호화: " << n_requests << "개, " << elapsed_ms(start, Clock::now()) / n_requests << " ms/요청" << std::endl;
+
+    // ====== 기준: 프로세스 내부 평가 (직렬화 없음) ======
+    PolyEvaluator evaluator(he.cc);
+    evaluator.evaluate(requests[0], poly);  // 계수 평문 캐시 워밍업
+    start = Clock::now();
+    for (const auto& ct : requests) evaluator.evaluate(ct, poly);
+    const double local_ms = elapsed_ms(start, Clock::now());
+
+    // 같은 암호문을 직렬화했을 때의 크기/시간 (전송 시 추가되는 비용의 하한)
+    std::vector<char> buffer;
+    start = Clock::now();
+    serialize_ciphertext(requests[0], buffer);
+    const double local_serialize_ms = elapsed_ms(start, Clock::now());
+    const size_t request_ct_bytes = buffer.size();
+    serialize_ciphertext(evaluator.evaluate(requests[0], poly), buffer);
+    const size_t result_ct_bytes = buffer.size();
+
+    // ====== 서버 평가 ======
+    std::vector<Ciphertext<DCRTPoly>> results;
+    ClientReport report;
+    try {
+        SinClient client(socket_path);
+        if (client.poly().coeffs != poly.coeffs || client.poly().s != poly.s) {
+            std::cerr << "서버의 다항식이 클라이언트 설정과 다릅니다 (--degree 확인)" << std::endl;
+            return 1;
+        }
+        client.evaluate(requests[0]);  // 연결/계수 캐시 워밍업
+        results = client.evaluate_many(requests, inflight, report);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    // ====== 결과 검증 (평문 정수 파이프라인과 비교) ======
+    size_t mismatches = 0;
+    for (const auto& ct_y : results) {
+        auto outputs = decrypt_batch(he.cc, he.keyPair.secretKey, {ct_y}, values_per_ct);
+        for (size_t i = 0; i < values_per_ct; i++) {
+            if (outputs[i] != eval_scaled_plain(poly, inputs[i], t)) mismatches++;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n요청 " << n_requests << "개, 요청당 값 " << values_per_ct << "개, inflight " << inflight << std::endl;
+    std::cout << "방식\t처리량(req/s)\t처리량(values/s)\t요청당(ms)\t요청(B)\t결과(B)" << std::endl;
+    std::cout << "프로세스 내부\t" << n_requests * 1000.0 / local_ms << "\t" << n_requests * values_per_ct * 1000.0 / local_ms
+              << "\t" << local_ms / n_requests << "\t-\t-" << std::endl;
+    std::cout << "소켓\t" << report.requests_per_sec << "\t" << report.requests_per_sec * values_per_ct << "\t"
+              << report.wall_ms / n_requests << "\t" << static_cast<size_t>(report.request_bytes) << "\t"
+              << static_cast<size_t>(report.result_bytes) << std::endl;
+
+    const double wire_ms = report.client_serialize_ms + report.server_deserialize_ms + report.server_serialize_ms +
+                           report.client_deserialize_ms;
+    std::cout << "\n직렬화 오버헤드 (요청당 평균 ms)" << std::endl;
+    std::cout << "  클라이언트 직렬화\t" << report.client_serialize_ms << " (프로세스 내부 측정 " << local_serialize_ms << ")" << std::endl;
+    std::cout << "  서버 역직렬화\t" << report.server_deserialize_ms << std::endl;
+    std::cout << "  서버 평가\t" << report.server_eval_ms << std::endl;
+    std::cout << "  서버 직렬화\t" << report.server_serialize_ms << std::endl;
+    std::cout << "  클라이언트 역직렬화\t" << report.client_deserialize_ms << std::endl;
+    std::cout << "  직렬화 합계 / 평가\t" << wire_ms << " / " << report.server_eval_ms << " ("
+              << (report.server_eval_ms > 0.0 ? 100.0 * wire_ms / report.server_eval_ms : 0.0) << "%)" << std::endl;
+    std::cout << "  암호문 크기\t입력 " << request_ct_bytes << " B, 결과 " << result_ct_bytes << " B (프레임 헤더 제외)" << std::endl;
+    std::cout << "  지연 p50 / p99\t" << report.latency_p50_ms << " / " << report.latency_p99_ms << " ms" << std::endl;
+    std::cout << "불일치: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
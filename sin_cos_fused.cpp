@@ -0,0 +1,191 @@
+#include <openfhe/pke/openfhe.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+#include "he_shadow.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_cos_fused [--degree 7] [--cos-degree 차수-1] [--s 자동] [--t 593779228673] [--ring 16384]
+//                        [--max-deg 90] [--poly c0,c1,...] [--iters 3]
+// 같은 암호문 각도에서 sin, cos (와 --poly 로 준 정수 다항식) 을 평가한다.
+// 1) 모든 입력을 그림자 평가해 결과가 감기는 입력이 있으면 암호문 연산 전에 거부
+// 2) 거듭제곱을 공유하는 evaluate_many 와 다항식마다 따로 evaluate 하는 경우의 연산 수 / 시간 비교
+// 3) 복호화 결과를 그림자 평가 기대값과 한꺼번에 대조
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 ======
+    const int64_t sin_degree_arg = arg_int(argc, argv, "--degree", 7);
+    const int64_t cos_degree_arg = arg_int(argc, argv, "--cos-degree", sin_degree_arg - 1);
+    if (sin_degree_arg < 1 || cos_degree_arg < 0) {
+        std::cerr << "--degree 는 1 이상, --cos-degree 는 0 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    const size_t sin_degree = sin_degree_arg;
+    const size_t cos_degree = cos_degree_arg;
+    int64_t s = arg_int(argc, argv, "--s", 0);
+    const int64_t PlaintextModulus = arg_int(argc, argv, "--t", 593779228673);
+    const uint32_t RingDim = arg_int(argc, argv, "--ring", 16384);
+    const int max_deg = arg_int(argc, argv, "--max-deg", 90);
+    const auto user_coeffs = arg_int_list(argc, argv, "--poly", "");
+    const size_t iters = std::max<int64_t>(1, arg_int(argc, argv, "--iters", 3));
+
+    // 정수화 분모 = n! (sin_taylor_poly 와 같은 규칙)
+    auto factorial = [](size_t n) {
+        int64_t value = 1;
+        for (size_t k = 2; k <= n; k++) value *= k;
+        return value;
+    };
+    auto make_polys = [&](int64_t scale_s) {
+        std::vector<ScaledPolynomial> polys = {make_taylor_sin(sin_degree, scale_s, factorial(sin_degree)),
+                                               make_taylor_cos(cos_degree, scale_s, factorial(cos_degree))};
+        if (!user_coeffs.empty()) {
+            ScaledPolynomial user;
+            user.coeffs = user_coeffs;
+            user.s = scale_s;
+            polys.push_back(user);
+        }
+        return polys;
+    };
+
+    // s 미지정 시: 모든 출력이 max_deg 입력까지 PlaintextModulus/2 안에 들어가는 가장 큰 s (최대 50)
+    const double x_max = max_deg * M_PI / 180.0;
+    if (s == 0) {
+        for (s = 50; s > 1; s--) {
+            bool fits = true;
+            for (const auto& poly : make_polys(s)) fits = fits && output_fits(poly, std::llround(s * x_max), PlaintextModulus);
+            if (fits) break;
+        }
+    }
+    const std::vector<ScaledPolynomial> polys = make_polys(s);
+    const std::vector<std::string> names = {"sin", "cos", "poly"};
+    size_t max_degree = 0;
+    for (const auto& poly : polys) max_degree = std::max(max_degree, poly.degree());
+    const uint32_t depth = required_depth(max_degree);
+
+    std::cout << "=== sin / cos 동시 평가 파라미터 ===" << std::endl;
+    std::cout << "PlaintextModulus: " << PlaintextModulus << ", s: " << s << ", 곱셈 뎁스: " << depth << std::endl;
+    for (size_t p = 0; p < polys.size(); p++) {
+        std::cout << names[p] << ": 차수 " << polys[p].degree();
+        // --poly 는 정수 다항식 그대로라 역스케일링 분모가 없다 (y_raw 만 출력)
+        if (p < 2) std::cout << ", 출력 스케일 " << polys[p].scale;
+        std::cout << std::endl;
+    }
+
+    // ====== 입력: -max_deg ~ max_deg 도, 10도 간격 ======
+    std::vector<int> degs;
+    std::vector<int64_t> inputs;
+    for (int deg = -max_deg / 10 * 10; deg <= max_deg; deg += 10) {
+        degs.push_back(deg);
+        inputs.push_back(static_cast<int64_t>(std::round(s * deg * M_PI / 180.0)));
+    }
+
+    // ====== 그림자 평가: 감기는 입력이 있으면 암호문 연산 없이 배치 거부 ======
+    std::vector<ShadowBatch> shadows;
+    bool rejected = false;
+    for (size_t p = 0; p < polys.size(); p++) {
+        shadows.push_back(shadow_evaluate(polys[p], inputs, PlaintextModulus));
+        const auto& shadow = shadows.back();
+        std::cout << "그림자 평가 (" << names[p] << "): " << shadow.ms << " ms, 감김 " << shadow.output_wraps
+                  << ", 넓은 항 " << shadow.wide_terms << ", 128비트 재계산 " << shadow.exact_fallbacks << std::endl;
+        rejected = rejected || !shadow.ok();
+    }
+    if (rejected) {
+        std::cerr << "결과가 PlaintextModulus/2 를 넘는 입력이 있어 배치를 거부합니다 (--s 또는 --t 조정)" << std::endl;
+        return 1;
+    }
+
+    // ====== 암호화 파라미터 설정 ======
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(depth);
+    parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(RingDim);
+
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+
+    auto ct_x = encrypt_batch(cc, keyPair.publicKey, inputs);
+
+    // ====== 동시 평가: 거듭제곱 한 번, 출력마다 계수 곱 + 합산 ======
+    PolyEvaluator evaluator(cc);
+    evaluator.evaluate_many(ct_x[0], polys);  // 계수 평문 캐시 워밍업
+    std::vector<std::vector<Ciphertext<DCRTPoly>>> fused(polys.size());
+    const double fused_ms = median_ms(iters, [&] {
+        for (auto& outputs : fused) outputs.clear();
+        for (const auto& ct : ct_x) {
+            auto results = evaluator.evaluate_many(ct, polys);
+            for (size_t p = 0; p < polys.size(); p++) fused[p].push_back(results[p]);
+        }
+    });
+    const PolyEvalStats fused_stats = evaluator.stats();
+
+    // ====== 따로 평가: 다항식마다 거듭제곱을 처음부터 ======
+    std::vector<std::vector<Ciphertext<DCRTPoly>>> separate(polys.size());
+    PolyEvalStats separate_stats;
+    const double separate_ms = median_ms(iters, [&] {
+        separate_stats = PolyEvalStats();
+        for (auto& outputs : separate) outputs.clear();
+        for (const auto& ct : ct_x) {
+            for (size_t p = 0; p < polys.size(); p++) {
+                separate[p].push_back(evaluator.evaluate(ct, polys[p]));
+                if (&ct == &ct_x.front()) {
+                    separate_stats.ct_mults += evaluator.stats().ct_mults;
+                    separate_stats.pt_mults += evaluator.stats().pt_mults;
+                    separate_stats.key_switches += evaluator.stats().key_switches;
+                }
+            }
+        }
+    });
+
+    // ====== 복호화 후 그림자 기대값과 일괄 대조 ======
+    std::vector<std::vector<int64_t>> outputs(polys.size());
+    size_t fused_mismatch = 0;
+    size_t separate_mismatch = 0;
+    for (size_t p = 0; p < polys.size(); p++) {
+        outputs[p] = decrypt_batch(cc, keyPair.secretKey, fused[p], inputs.size());
+        fused_mismatch += shadow_mismatches(shadows[p], outputs[p]).size();
+        separate_mismatch +=
+            shadow_mismatches(shadows[p], decrypt_batch(cc, keyPair.secretKey, separate[p], inputs.size())).size();
+    }
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "\n각도(도)\tsin 근사\tsin 오차\tcos 근사\tcos 오차";
+    if (polys.size() > 2) std::cout << "\tpoly y_raw";
+    std::cout << std::endl;
+    double sin_error = 0.0;
+    double cos_error = 0.0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const double x = degs[i] * M_PI / 180.0;
+        const double y_sin = static_cast<double>(outputs[0][i]) / polys[0].scale;
+        const double y_cos = static_cast<double>(outputs[1][i]) / polys[1].scale;
+        sin_error = std::max(sin_error, std::abs(y_sin - std::sin(x)));
+        cos_error = std::max(cos_error, std::abs(y_cos - std::cos(x)));
+        std::cout << degs[i] << "\t" << y_sin << "\t" << std::abs(y_sin - std::sin(x)) << "\t" << y_cos << "\t"
+                  << std::abs(y_cos - std::cos(x));
+        if (polys.size() > 2) std::cout << "\t" << outputs[2][i];
+        std::cout << std::endl;
+    }
+
+    const PolyEvalStats planned = plan_poly_eval_many(polys);
+    std::cout << "\n=== 동시 평가 vs 따로 평가 (암호문당) ===" << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "암호문 곱셈: 동시 " << fused_stats.ct_mults << " (계획 " << planned.ct_mults << "), 따로 "
+              << separate_stats.ct_mults << std::endl;
+    std::cout << "키 스위칭: 동시 " << fused_stats.key_switches << ", 따로 " << separate_stats.key_switches << std::endl;
+    std::cout << "평문 곱셈: 동시 " << fused_stats.pt_mults << ", 따로 " << separate_stats.pt_mults << std::endl;
+    std::cout << "연산(ms, 암호문 " << ct_x.size() << "개): 동시 " << fused_ms << ", 따로 " << separate_ms << " ("
+              << separate_ms / fused_ms << "x)" << std::endl;
+    std::cout << "그림자 기대값과 불일치: 동시 " << fused_mismatch << ", 따로 " << separate_mismatch << " / "
+              << inputs.size() * polys.size() << std::endl;
+    std::cout << std::setprecision(6) << "최대 오차: sin " << sin_error << ", cos " << cos_error << std::endl;
+
+    return (fused_mismatch == 0 && separate_mismatch == 0) ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+#include <openfhe/pke/openfhe.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "he_common.h"
+#include "he_crt.h"
+#include "he_modmath.h"
+#include "he_poly_eval.h"
+#include "he_tune.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_crt [--degree 5] [--s 50] [--k 3] [--security 128] [--ring 8192] [--threads 1] [--iters 10]
+//                  [--baseline-t 자동] [--baseline-ring 16384]
+// -180 ~ 180도 (10도 간격) 를 한 번에 평가하며 세 가지를 비교한다.
+// 1) CRT 병렬: 작은 슬롯 패킹 소수 k 개, 채널마다 컨텍스트 하나 + 스레드 하나 (--security 보안)
+// 2) CRT 차례: 같은 컨텍스트로 채널을 하나씩
+// 3) 단일 모듈러스: 큰 t 하나, HEStd_NotSet (sin_taylor_fifth 방식, --baseline-t 0 이면 y 범위를 담는 가장 작은 소수)
+namespace {
+
+struct ModeResult {
+    std::string name;
+    std::vector<double> encrypt_ms, eval_ms, decrypt_ms, combine_ms, total_ms;
+    size_t mismatches = 0;   // CRT 합성 값이 mod 없는 정확한 y_scaled 와 다른 수
+    double max_error = 0.0;  // max |y - sin(x)|
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 ======
+    if (arg_int(argc, argv, "--degree", 5) < 1) {
+        std::cerr << "--degree 는 1 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    const size_t degree = arg_int(argc, argv, "--degree", 5);
+    const int64_t s = arg_int(argc, argv, "--s", 50);
+    const size_t iters = std::max<int64_t>(1, arg_int(argc, argv, "--iters", 10));
+    const uint32_t baseline_ring = arg_int(argc, argv, "--baseline-ring", 16384);
+
+    CrtConfig config;
+    config.moduli = arg_int(argc, argv, "--k", 3);
+    config.security = parse_security(arg_str(argc, argv, "--security", "128"));
+    config.min_ring_dim = arg_int(argc, argv, "--ring", 8192);
+    config.openfhe_threads = arg_int(argc, argv, "--threads", 1);
+
+    // 정수화 분모 = n! (sin_taylor_poly 와 동일)
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+    const ScaledPolynomial poly = make_taylor_sin(degree, s, denom);
+
+    std::vector<int> degs;
+    std::vector<int64_t> inputs;
+    for (int deg = -180; deg <= 180; deg += 10) {
+        degs.push_back(deg);
+        inputs.push_back(static_cast<int64_t>(std::round(s * deg * M_PI / 180.0)));
+    }
+    const int64_t x_limit = std::llround(s * M_PI);
+    const int128_t y_bound = output_bound(poly, x_limit);
+
+    std::cout << "=== CRT 분할 평문 모듈러스: " << degree << "차, s = " << s << ", denom = " << denom << " ===" << std::endl;
+    std::cout << "max |y_scaled|: " << static_cast<double>(y_bound) << " (약 "
+              << std::log2(static_cast<double>(2 * y_bound + 1)) << " 비트 범위 필요), 곱셈 뎁스 "
+              << required_depth(degree) << std::endl;
+
+    // ====== CRT 채널 ======
+    auto crt = make_crt_evaluator(poly, x_limit, config);
+    if (!crt) {
+        std::cerr << "보안 수준 " << security_name(config.security) << " 을 만족하는 CRT 구성을 찾지 못했습니다 (--k 를 늘려 보세요)"
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "\nCRT: 채널 " << crt->moduli().size() << "개, 링 차원 " << crt->ring_dim() << ", 보안 "
+              << security_name(config.security) << ", 컨텍스트/키 준비 " << crt->setup_ms() << " ms" << std::endl;
+    for (const auto& channel : crt->channels()) {
+        std::cout << "  t = " << channel.t << " (" << std::log2(static_cast<double>(channel.t)) << " 비트), 타워 "
+                  << channel.towers << (channel.he.from_cache ? ", 캐시 로드" : ", 새로 생성") << std::endl;
+    }
+    std::cout << "  T = " << static_cast<double>(crt_product(crt->moduli())) << std::endl;
+
+    // ====== 단일 모듈러스 (기준) ======
+    int64_t baseline_t = arg_int(argc, argv, "--baseline-t", 0);
+    if (baseline_t == 0) baseline_t = next_packing_prime(static_cast<uint64_t>(2 * y_bound + 1), baseline_ring);
+    CrtConfig baseline_config;
+    baseline_config.moduli = 1;
+    baseline_config.security = SecurityLevel::HEStd_NotSet;
+    baseline_config.openfhe_threads = config.openfhe_threads;
+    std::unique_ptr<CrtEvaluator> baseline;
+    try {
+        baseline = std::make_unique<CrtEvaluator>(poly, std::vector<uint64_t>{static_cast<uint64_t>(baseline_t)},
+                                                  baseline_ring, baseline_config);
+        std::cout << "단일: t = " << baseline_t << " (" << std::log2(static_cast<double>(baseline_t)) << " 비트), 링 차원 "
+                  << baseline_ring << ", 보안 notset, 타워 " << baseline->channels()[0].towers << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "단일: t = " << baseline_t << " 컨텍스트 생성 실패 (" << e.what() << ")" << std::endl;
+    }
+
+    // ====== 측정 ======
+    auto run_mode = [&](const std::string& name, CrtEvaluator& evaluator) {
+        ModeResult result;
+        result.name = name;
+        for (size_t it = 0; it < iters; it++) {
+            CrtTiming timing;
+            const auto outputs = evaluator.evaluate(inputs, &timing);
+            result.encrypt_ms.push_back(timing.encrypt_ms);
+            result.eval_ms.push_back(timing.eval_ms);
+            result.decrypt_ms.push_back(timing.decrypt_ms);
+            result.combine_ms.push_back(timing.combine_ms);
+            result.total_ms.push_back(timing.total_ms);
+
+            for (size_t i = 0; i < inputs.size(); i++) {
+                int128_t exact = 0;
+                for (size_t k = poly.coeffs.size(); k-- > 0;) exact = exact * inputs[i] + poly.coeffs[k];
+                if (outputs[i] != exact) result.mismatches++;
+                const double y = static_cast<double>(outputs[i]) / poly.scale;
+                result.max_error = std::max(result.max_error, std::abs(y - std::sin(degs[i] * M_PI / 180.0)));
+            }
+        }
+        return result;
+    };
+
+    std::vector<ModeResult> results;
+    crt->set_parallel(true);
+    results.push_back(run_mode("CRT 병렬", *crt));
+    crt->set_parallel(false);
+    results.push_back(run_mode("CRT 차례", *crt));
+    if (baseline) results.push_back(run_mode("단일", *baseline));
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== 지연 (ms, 입력 " << inputs.size() << "개 한 배치, " << iters << "회) ===" << std::endl;
+    std::cout << "모드\t암호화\t연산\t복호화\tCRT 합성\t전체 p50\t전체 p99\t불일치\t최대 오차" << std::endl;
+    for (const auto& r : results) {
+        std::cout << r.name << "\t" << median_of(r.encrypt_ms) << "\t" << median_of(r.eval_ms) << "\t"
+                  << median_of(r.decrypt_ms) << "\t" << std::setprecision(4) << median_of(r.combine_ms)
+                  << std::setprecision(2) << "\t" << median_of(r.total_ms) << "\t" << percentile_of(r.total_ms, 99.0)
+                  << "\t" << r.mismatches << "\t" << std::setprecision(6) << r.max_error << std::setprecision(2)
+                  << std::endl;
+    }
+    if (baseline) {
+        std::cout << "CRT 병렬 / 단일 전체 p50: " << median_of(results[0].total_ms) / median_of(results.back().total_ms) << "x"
+                  << std::endl;
+    }
+    std::cout << "CRT 차례 / CRT 병렬 전체 p50: " << median_of(results[1].total_ms) / median_of(results[0].total_ms) << "x"
+              << std::endl;
+
+    size_t mismatches = 0;
+    for (const auto& r : results) mismatches += r.mismatches;
+    return mismatches == 0 ? 0 : 1;
+}
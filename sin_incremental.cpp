@@ -0,0 +1,177 @@
+#include <openfhe/pke/openfhe.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "he_angle_tracker.h"
+#include "he_backend.h"
+#include "he_common.h"
+#include "he_stream.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_incremental [--samples 6000] [--refresh 8] [--degree 13] [--x-max 2.5] [--full-stride 20]
+//                          [--seed 1] [--output sin_incremental_out.tsv]
+// talyor.m 랜덤워크 각도를 샘플마다 처리한다.
+// - 증분: 스텝 d(k) 암호문으로 (sin x, cos x) 상태를 덧셈 정리로 갱신, --refresh 번마다 절대각에서 다시 평가
+// - 전체: 매 샘플 절대각 암호문에서 sin, cos 체비쇼프 평가 (--full-stride 샘플마다 하나씩만 실행)
+namespace {
+
+double decrypt_slot0(const CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& secretKey,
+                     const Ciphertext<DCRTPoly>& ct) {
+    Plaintext p;
+    cc->Decrypt(secretKey, ct, &p);
+    p->SetLength(1);
+    return p->GetRealPackedValue()[0];
+}
+
+struct ModeResult {
+    std::vector<double> eval_ms;       // 서버 연산
+    std::vector<double> total_ms;      // 암호화 + 연산 + 복호화
+    double max_error = 0.0;            // max(|sin 오차|, |cos 오차|)
+    double sum_error = 0.0;
+    size_t samples = 0;
+
+    void add(double eval, double total, double error) {
+        eval_ms.push_back(eval);
+        total_ms.push_back(total);
+        max_error = std::max(max_error, error);
+        sum_error += error;
+        samples++;
+    }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 ======
+    const size_t n_samples = arg_int(argc, argv, "--samples", 6000);
+    const size_t full_stride = std::max<int64_t>(1, arg_int(argc, argv, "--full-stride", 20));
+    const std::string output_path = arg_str(argc, argv, "--output", "sin_incremental_out.tsv");
+
+    AngleTrackerConfig config;
+    config.refresh_interval = arg_int(argc, argv, "--refresh", 8);
+    config.full_degree = arg_int(argc, argv, "--degree", 13);
+    config.x_max = arg_double(argc, argv, "--x-max", 2.5);
+
+    AngleTrackerConfig full_config = config;
+    full_config.refresh_interval = 0;
+
+    const auto x = generate_random_walk(n_samples, static_cast<uint32_t>(arg_int(argc, argv, "--seed", 1)));
+    double x_abs_max = 0.0;
+    for (double v : x) x_abs_max = std::max(x_abs_max, std::abs(v));
+    if (x_abs_max > config.x_max) {
+        std::cerr << "각도 " << x_abs_max << " 가 체비쇼프 범위 " << config.x_max << " 를 넘습니다 (--x-max 조정)" << std::endl;
+        return 1;
+    }
+
+    std::cout << "=== 증분 각도 추적 (CKKS) ===" << std::endl;
+    std::cout << "샘플: " << n_samples << ", |x| 최대: " << x_abs_max << " rad" << std::endl;
+    std::cout << "증분: 다시 평가 주기 " << config.refresh_interval << ", 곱셈 뎁스 " << angle_tracker_depth(config)
+              << " (스텝 근사 " << kAngleStepDepth << " + 상태 갱신 1)" << std::endl;
+    std::cout << "전체: 체비쇼프 " << config.full_degree << "차, 곱셈 뎁스 " << angle_tracker_depth(full_config)
+              << ", " << full_stride << " 샘플마다 실행" << std::endl;
+
+    auto he = make_angle_tracker_context(config);
+    auto he_full = make_angle_tracker_context(full_config);
+    std::cout << "컨텍스트/키 준비: 증분 " << he.setup_ms << " ms, 전체 " << he_full.setup_ms << " ms" << std::endl;
+
+    // level > 0 이면 그 레벨의 평문으로 암호화 (타워가 적어 암호화와 이후 연산이 가볍다)
+    auto encrypt = [](const HeContext& ctx, double value, uint32_t level) {
+        return ctx.cc->Encrypt(ctx.keyPair.publicKey,
+                               ctx.cc->MakeCKKSPackedPlaintext(std::vector<double>{value}, 1, level));
+    };
+
+    std::ofstream out(output_path);
+    out << std::fixed << std::setprecision(8);
+    out << "index\tx_input(rad)\t모드\tsin 근사\tcos 근사\tsin 오차\tcos 오차\n";
+
+    AngleTracker tracker(he.cc, config);
+    AngleTracker full(he_full.cc, full_config);
+    ModeResult incremental, updates_only, refreshes_only, full_result;
+    std::vector<double> error_by_age(config.refresh_interval + 1, 0.0);  // 다시 평가 뒤 갱신 횟수별 최대 오차
+    size_t age = 0;
+
+    for (size_t k = 0; k < n_samples; k++) {
+        // ====== 증분 ======
+        const bool refresh = tracker.needs_refresh();
+        auto start = Clock::now();
+        auto ct_in = refresh ? encrypt(he, x[k], 0) : encrypt(he, x[k] - x[k - 1], tracker.step_level());
+        auto start_eval = Clock::now();
+        if (refresh) {
+            tracker.refresh(ct_in);
+            age = 0;
+        } else {
+            tracker.update(ct_in);
+            age++;
+        }
+        auto end_eval = Clock::now();
+        const double y_sin = decrypt_slot0(he.cc, he.keyPair.secretKey, tracker.sin_state());
+        const double y_cos = decrypt_slot0(he.cc, he.keyPair.secretKey, tracker.cos_state());
+        auto end = Clock::now();
+
+        const double sin_error = std::abs(y_sin - std::sin(x[k]));
+        const double cos_error = std::abs(y_cos - std::cos(x[k]));
+        const double error = std::max(sin_error, cos_error);
+        incremental.add(elapsed_ms(start_eval, end_eval), elapsed_ms(start, end), error);
+        (refresh ? refreshes_only : updates_only).add(elapsed_ms(start_eval, end_eval), elapsed_ms(start, end), error);
+        if (age < error_by_age.size()) error_by_age[age] = std::max(error_by_age[age], error);
+        out << k << "\t" << x[k] << "\t" << (refresh ? "R" : "U") << "\t" << y_sin << "\t" << y_cos << "\t"
+            << sin_error << "\t" << cos_error << "\n";
+
+        // ====== 전체 재평가 (표본) ======
+        if (k % full_stride == 0) {
+            auto full_start = Clock::now();
+            auto ct_x = encrypt(he_full, x[k], 0);
+            auto full_start_eval = Clock::now();
+            full.refresh(ct_x);
+            auto full_end_eval = Clock::now();
+            const double f_sin = decrypt_slot0(he_full.cc, he_full.keyPair.secretKey, full.sin_state());
+            const double f_cos = decrypt_slot0(he_full.cc, he_full.keyPair.secretKey, full.cos_state());
+            auto full_end = Clock::now();
+            full_result.add(elapsed_ms(full_start_eval, full_end_eval), elapsed_ms(full_start, full_end),
+                            std::max(std::abs(f_sin - std::sin(x[k])), std::abs(f_cos - std::cos(x[k]))));
+        }
+
+        if ((k + 1) % 1000 == 0) std::cout << "  " << k + 1 << " / " << n_samples << " 샘플" << std::endl;
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "\n=== 샘플당 지연 (ms) ===" << std::endl;
+    std::cout << "모드\t샘플\t연산 p50\t연산 p99\t전체 p50\t전체 p99\t평균 연산" << std::endl;
+    auto print_row = [&](const std::string& name, const ModeResult& r) {
+        double sum = 0.0;
+        for (double v : r.eval_ms) sum += v;
+        std::cout << name << "\t" << r.samples << "\t" << percentile_of(r.eval_ms, 50.0) << "\t" << percentile_of(r.eval_ms, 99.0) << "\t"
+                  << percentile_of(r.total_ms, 50.0) << "\t" << percentile_of(r.total_ms, 99.0) << "\t"
+                  << (r.samples ? sum / r.samples : 0.0) << std::endl;
+    };
+    print_row("증분(전체)", incremental);
+    print_row("증분:갱신", updates_only);
+    print_row("증분:재평가", refreshes_only);
+    print_row("전체 재평가", full_result);
+
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "\n=== 누적 오차 max(|sin 오차|, |cos 오차|) ===" << std::endl;
+    std::cout << "증분: 최대 " << incremental.max_error << ", 평균 "
+              << incremental.sum_error / std::max<size_t>(1, incremental.samples) << std::endl;
+    std::cout << "전체 재평가: 최대 " << full_result.max_error << ", 평균 "
+              << full_result.sum_error / std::max<size_t>(1, full_result.samples) << std::endl;
+    std::cout << "다시 평가 뒤 갱신 횟수별 최대 오차:";
+    for (size_t a = 0; a < error_by_age.size(); a++) std::cout << " [" << a << "] " << error_by_age[a];
+    std::cout << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== 샘플당 뎁스 / 키 스위칭 ===" << std::endl;
+    std::cout << "증분 갱신: 스텝 근사 뎁스 " << kAngleStepDepth << ", 상태가 쓰는 레벨 1, 재선형화 "
+              << (tracker.stats().updates ? tracker.stats().key_switches / tracker.stats().updates : 0) << "회"
+              << std::endl;
+    std::cout << "전체 재평가: 뎁스 " << chebyshev_depth(config.full_degree) << " (sin, cos 체비쇼프 각각)" << std::endl;
+    std::cout << "갱신 " << tracker.stats().updates << "회, 다시 평가 " << tracker.stats().refreshes << "회" << std::endl;
+    std::cout << "결과 파일: " << output_path << std::endl;
+
+    return 0;
+}
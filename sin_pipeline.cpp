@@ -0,0 +1,107 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_pipeline.h"
+#include "he_poly_eval.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_pipeline [--degree 5] [--inputs 3700] [--values-per-ct 1]
+//                       [--enc 1] [--eval 1] [--dec 1] [--omp 1] [--queue 4] [--sweep]
+// --sweep: 워커 수를 3, 4, 8, ... 코어 수까지 늘려가며 처리량/지연 측정 (OpenFHE 내부 스레드는 1)
+//          단계마다 최소 한 스레드라 3 부터 시작하고, 각 행의 "워커" 는 세 단계 스레드 수의 합
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 (5차 근사와 동일) ======
+    if (arg_int(argc, argv, "--degree", 5) < 1) {
+        std::cerr << "--degree 는 1 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    const size_t degree = arg_int(argc, argv, "--degree", 5);
+    const int64_t s = 50;
+    const int64_t PlaintextModulus = 593779228673;
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+    const ScaledPolynomial poly = make_taylor_sin(degree, s, denom);
+
+    const size_t n_inputs = arg_int(argc, argv, "--inputs", 3700);
+
+    PipelineConfig config;
+    config.encrypt_threads = std::max<int64_t>(1, arg_int(argc, argv, "--enc", 1));
+    config.eval_threads = std::max<int64_t>(1, arg_int(argc, argv, "--eval", 1));
+    config.decrypt_threads = std::max<int64_t>(1, arg_int(argc, argv, "--dec", 1));
+    config.openfhe_threads = std::max<int64_t>(1, arg_int(argc, argv, "--omp", 1));
+    config.queue_capacity = arg_int(argc, argv, "--queue", 4);
+    config.values_per_item = arg_int(argc, argv, "--values-per-ct", 1);
+
+    // ====== 암호화 파라미터 설정 ======
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(required_depth(poly.degree()));
+    parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(16384);
+
+    auto he = load_or_create_context(parameters);
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+
+    // ====== 입력: -180 ~ 180도, 10도 간격을 n_inputs 개까지 반복 ======
+    std::vector<int64_t> inputs(n_inputs);
+    for (size_t i = 0; i < n_inputs; i++) {
+        int deg = -180 + 10 * static_cast<int>(i % 37);
+        inputs[i] = static_cast<int64_t>(std::round(s * deg * M_PI / 180.0));
+    }
+
+    std::vector<PipelineConfig> runs;
+    if (arg_flag(argc, argv, "--sweep")) {
+        const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<size_t> worker_counts = {3};
+        for (size_t workers = 4; workers < cores; workers *= 2) worker_counts.push_back(workers);
+        if (cores > 3) worker_counts.push_back(cores);
+
+        for (size_t workers : worker_counts) {
+            // 평가 단계가 가장 무거우므로 대부분의 워커를 평가에 배정
+            PipelineConfig run = config;
+            run.openfhe_threads = 1;
+            run.encrypt_threads = std::max<size_t>(1, workers / 4);
+            run.decrypt_threads = std::max<size_t>(1, workers / 8);
+            run.eval_threads = workers > run.encrypt_threads + run.decrypt_threads
+                                   ? workers - run.encrypt_threads - run.decrypt_threads : 1;
+            runs.push_back(run);
+        }
+    } else {
+        runs.push_back(config);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "워커\t암호화\t평가\t복호화\tOMP\t값/암호문\t값 개수\t총시간(ms)\t처리량(values/s)\tp50(ms)\tp90(ms)\tp99(ms)\t최대(ms)\t불일치" << std::endl;
+    for (const auto& run : runs) {
+        std::vector<int64_t> outputs;
+        PipelineReport report;
+        try {
+            report = run_pipeline(he.cc, he.keyPair, poly, inputs, run, outputs);
+        } catch (const std::exception& e) {
+            std::cerr << "파이프라인 실패: " << e.what() << std::endl;
+            return 1;
+        }
+
+        size_t mismatch = 0;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (outputs[i] != eval_scaled_plain(poly, inputs[i], PlaintextModulus)) mismatch++;
+        }
+
+        std::cout << run.encrypt_threads + run.eval_threads + run.decrypt_threads
+                  << "\t" << run.encrypt_threads << "\t" << run.eval_threads << "\t" << run.decrypt_threads
+                  << "\t" << run.openfhe_threads << "\t" << (run.values_per_item ? run.values_per_item : slot_count(he.cc))
+                  << "\t" << report.values << "\t" << report.wall_ms << "\t" << report.values_per_sec
+                  << "\t" << report.latency_p50_ms << "\t" << report.latency_p90_ms
+                  << "\t" << report.latency_p99_ms << "\t" << report.latency_max_ms
+                  << "\t" << mismatch << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <openfhe/pke/openfhe.h>
+#include <csignal>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#include <pthread.h>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_service.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_server [--socket /tmp/enc_sin.sock] [--degree 5] [--keys server_keys]
+// 컨텍스트, 공개키, eval 키만 로드해 (비밀키 없음) Unix 소켓으로 들어오는 암호문에 sin 다항식을 평가한다.
+// 키는 먼저 ./sin_client --setup 으로 내보낸 서버용 디렉토리 (cc.bin / pk.bin / evalmult.bin) 를 쓴다.
+// 그 디렉토리에 sk.bin 이 있으면 시작하지 않는다.
+int main(int argc, char* argv[]) {
+    const std::string socket_path = arg_str(argc, argv, "--socket", "/tmp/enc_sin.sock");
+    const size_t degree = arg_int(argc, argv, "--degree", 5);
+    const ServiceSetup setup = make_service_setup(degree);
+
+    const std::string keys = arg_str(argc, argv, "--keys", kServerKeysDir);
+    if (std::filesystem::exists(std::filesystem::path(keys) / "sk.bin")) {
+        std::cerr << "키 디렉토리에 비밀키(sk.bin)가 있습니다 (" << keys << "): 서버는 비밀키 없는 디렉토리만 사용합니다."
+                  << " ./sin_client --setup 이 내보낸 디렉토리를 지정하세요" << std::endl;
+        return 1;
+    }
+    HeContext he;
+    auto start = Clock::now();
+    if (!load_public_context(keys, he)) {
+        std::cerr << "공개키/eval 키를 찾을 수 없습니다 (" << keys << "): 먼저 ./sin_client --setup --degree " << degree
+                  << " 을 실행하세요" << std::endl;
+        return 1;
+    }
+    std::cout << "공개 키 로드: " << keys << " (" << elapsed_ms(start, Clock::now()) << " ms, 비밀키 없음)" << std::endl;
+    std::cout << "다항식: " << degree << "차, s = " << setup.poly.s << ", 링 차원 " << he.cc->GetRingDimension() << std::endl;
+
+    // SIGINT / SIGTERM 은 전용 스레드가 sigwait 로 받아 server.stop() 으로 정리 종료
+    // (연결 스레드가 만들어지기 전에 막아 두어 모든 스레드가 상속한다)
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    SinServer server(he, setup.poly);
+    std::thread([&server, signals] {
+        int signal_number = 0;
+        sigwait(&signals, &signal_number);
+        std::cout << "종료 신호 (" << signal_number << "): 연결 정리 중" << std::endl;
+        server.stop();
+    }).detach();
+
+    try {
+        server.serve(socket_path);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
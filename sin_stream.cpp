@@ -0,0 +1,102 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+#include "he_stream.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_stream [--input 파일|-] [--generate 6000] [--output sin_stream_out.tsv]
+//                     [--rate 100] [--deadline 500] [--degree 5] [--s 50]
+// 입력: 한 줄에 각도(rad) 하나. --input 이 없으면 talyor.m 과 같은 랜덤워크 신호를 생성해 사용
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 ======
+    const size_t degree = arg_int(argc, argv, "--degree", 5);
+    const int64_t s = arg_int(argc, argv, "--s", 50);
+    const int64_t PlaintextModulus = 593779228673;
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+    const ScaledPolynomial poly = make_taylor_sin(degree, s, denom);
+
+    StreamConfig config;
+    config.sample_rate_hz = static_cast<double>(arg_int(argc, argv, "--rate", 100));
+    config.deadline_ms = static_cast<double>(arg_int(argc, argv, "--deadline", 500));
+
+    const std::string input_path = arg_str(argc, argv, "--input", "");
+    const std::string output_path = arg_str(argc, argv, "--output", "sin_stream_out.tsv");
+
+    // ====== 암호화 파라미터 설정 ======
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(required_depth(poly.degree()));
+    parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(16384);
+
+    auto he = load_or_create_context(parameters);
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+
+    // ====== 결과는 입력 순서대로 파일에 기록 ======
+    std::ofstream out(output_path);
+    out << std::fixed << std::setprecision(6);
+    out << "index\tx_input(rad)\t근사값\t실제값\t오차\n";
+    double max_error = 0.0;
+    size_t overflow = 0;
+    auto sink = [&](size_t index, double x, double y) {
+        double y_true = std::sin(x);
+        double error = std::abs(y_true - y);
+        max_error = std::max(max_error, error);
+        out << index << "\t" << x << "\t" << y << "\t" << y_true << "\t" << error << "\n";
+    };
+    SinStreamProcessor stream(he.cc, he.keyPair, poly, config, sink);
+
+    // ====== 입력 스트림 ======
+    auto push_checked = [&](double x) {
+        // 결과가 PlaintextModulus/2 를 넘는 입력은 표시만 하고 그대로 평가 (결과는 wraparound)
+        int64_t x_scaled = static_cast<int64_t>(std::round(s * x));
+        if (!output_in_range(poly, x_scaled, PlaintextModulus)) overflow++;
+        stream.push(x);
+    };
+    if (input_path.empty()) {
+        for (double x : generate_random_walk(arg_int(argc, argv, "--generate", 6000))) push_checked(x);
+    } else if (input_path == "-") {
+        double x;
+        while (std::cin >> x) push_checked(x);
+    } else {
+        std::ifstream in(input_path);
+        double x;
+        while (in >> x) push_checked(x);
+    }
+    stream.flush();
+
+    auto report = stream.report();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== 스트리밍 결과 (" << config.sample_rate_hz << " Hz, 마감 " << config.deadline_ms << " ms) ===" << std::endl;
+    std::cout << "샘플 수: " << report.samples << ", 윈도우 수: " << report.windows
+              << ", 평균 윈도우 크기: " << static_cast<double>(report.samples) / std::max<size_t>(1, report.windows) << std::endl;
+    std::cout << "총 처리 시간(ms): " << report.compute_ms << std::endl;
+    std::cout << "지속 처리량(samples/s): " << report.samples_per_sec
+              << " (실시간 대비 " << report.realtime_factor << "배)" << std::endl;
+    std::cout << "샘플 클럭 대비 지연 최대/마지막(ms): " << report.max_lag_ms << " / " << report.final_lag_ms << std::endl;
+    std::cout << "윈도우 지연 p50/p99(ms): " << report.latency_p50_ms << " / " << report.latency_p99_ms
+              << ", 마감 초과 비율: " << report.deadline_miss * 100.0 << "%" << std::endl;
+    std::cout << "실시간 유지: " << (report.realtime_factor >= 1.0 && report.deadline_miss == 0.0 ? "O" : "X") << std::endl;
+    std::cout << std::setprecision(6) << "최대 오차: " << max_error
+              << ", 모듈러스 초과 입력: " << overflow << std::endl;
+    std::cout << "결과 파일: " << output_path << std::endl;
+
+    std::cout << "\n윈도우\t첫 샘플\t샘플 수\t처리(ms)\t지연(ms)\tlag(ms)" << std::endl;
+    std::cout << std::setprecision(2);
+    const auto& windows = stream.windows();
+    for (size_t i = 0; i < windows.size(); i++) {
+        std::cout << i << "\t" << windows[i].first << "\t" << windows[i].count << "\t" << windows[i].compute_ms
+                  << "\t" << windows[i].latency_ms << "\t" << windows[i].lag_ms << std::endl;
+    }
+
+    return 0;
+}
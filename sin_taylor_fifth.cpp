@@ -5,6 +5,13 @@
 #include <iomanip>
 #include <chrono>
 
+#include "he_common.h"
+#include "he_coeff_store.h"
+#include "he_context_cache.h"
+#include "he_encrypt_pool.h"
+#include "he_poly_eval.h"
+#include "he_trace.h"
+
 using namespace lbcrypto;
 
 int main() {
@@ -36,17 +43,34 @@ int main() {
     parameters.SetSecurityLevel(SecurityLevel::HEStd_NotSet);
     parameters.SetRingDim(16384); // 링 차원을 줄여서 모듈러스 크기 문제 해결
 
-    auto cc = GenCryptoContext(parameters);
-    cc->Enable(PKE);
-    cc->Enable(LEVELEDSHE);
-    cc->Enable(ADVANCEDSHE);
-
-    auto keyPair = cc->KeyGen();
-    cc->EvalMultKeyGen(keyPair.secretKey);
+    // 컨텍스트 + 키 (디스크 캐시가 있으면 로드)
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
 
     std::cout << std::fixed << std::setprecision(6);
     std::cout << "각도(도)\tx_input(rad)\t근사값\t실제값\t오차\tterm1_raw\tterm2_raw\tterm3_raw\tterm1_mod\tterm2_mod\tterm3_mod\t암호화(ms)\t연산(ms)\t복호화(ms)\t총시간(ms)" << std::endl;
 
+    // 계수 평문 캐시: ic1, ic3, ic5 를 레벨별로 한 번만 인코딩 (NTT 형태)
+    auto coeffs = std::make_shared<CoeffStore>(cc);
+
+    // 배치 모드와 비교하기 위한 각도별 결과/시간 누적
+    std::vector<int64_t> sweep_inputs;
+    std::vector<int64_t> sweep_outputs;
+    double sweep_total_ms = 0.0;
+    double sweep_encrypt_ms = 0.0;
+
+    // 암호화 풀: 스윕 입력 37개보다 많은 Enc(0) 를 미리 채워 두고 온라인 암호화는 EvalAdd(Enc(0), pt) 만 한다
+    // (보충 스레드는 연산 시간 측정에 끼어들지 않도록 끈다)
+    EncryptPoolConfig pool_config;
+    pool_config.capacity = 40;
+    pool_config.refill_threads = 0;
+    EncryptPool pool(cc, keyPair.publicKey, pool_config);
+    pool.fill();
+
+    std::vector<size_t> term_towers_before, term_towers_after;
+
     for (int deg = -180; deg <= 180; deg += 10) {
         double x_input = deg * M_PI / 180.0;
         int64_t x_scaled = static_cast<int64_t>(std::round(s * x_input));
@@ -56,31 +80,41 @@ int main() {
         auto start_encrypt = std::chrono::high_resolution_clock::now();
         
         // ====== 암호화 ======
-        auto p_x = cc->MakePackedPlaintext({x_scaled});
-        auto ct_x = cc->Encrypt(keyPair.publicKey, p_x);
+        auto p_x = traced_make_packed_plaintext(cc, {x_scaled}, "x");
+        auto ct_x = pool.encrypt(p_x);
         
         auto end_encrypt = std::chrono::high_resolution_clock::now();
         auto start_compute = std::chrono::high_resolution_clock::now();
         
         // ====== 암호공간 연산 ======
-        auto ct_x2 = cc->EvalMult(ct_x, ct_x);
-        auto ct_x3 = cc->EvalMult(ct_x2, ct_x);
-        auto ct_x5 = cc->EvalMult(ct_x3, ct_x2);
-
-        int64_t ic3_mod = (ic3 < 0) ? (PlaintextModulus + ic3) : ic3;
-        int64_t ic5_mod = (ic5 < 0) ? (PlaintextModulus + ic5) : ic5;
-        auto term1 = cc->EvalMult(ct_x, cc->MakePackedPlaintext({ic1}));
-        auto term2 = cc->EvalMult(ct_x3, cc->MakePackedPlaintext({ic3_mod}));
-        auto term3 = cc->EvalMult(ct_x5, cc->MakePackedPlaintext({ic5_mod}));
+        // (ENC_SIN_TRACE=경로 로 실행하면 아래 연산마다 시간, 레벨, 타워 수, 힙 변화가 label 별로 Chrome trace 에 남는다)
+        auto ct_x2 = traced_eval_mult(cc, ct_x, ct_x, "x^2");
+        auto ct_x3 = traced_eval_mult(cc, ct_x2, ct_x, "x^3");
+        // x^5 는 계수 곱 후 바로 복호화되는 잎이므로 재선형화하지 않는다 (3성분 그대로 복호화)
+        auto ct_x5 = traced_eval_mult_no_relin(cc, ct_x3, ct_x2, "x^5");
+
+        auto term1 = traced_eval_mult(cc, ct_x, coeffs->scalar(ic1, ct_x), "term1");
+        auto term2 = traced_eval_mult(cc, ct_x3, coeffs->scalar(ic3, ct_x3), "term2");
+        auto term3 = traced_eval_mult(cc, ct_x5, coeffs->scalar(ic5, ct_x5), "term3");
+
+        // 복호화 전에 각 항을 복호화에 필요한 최소 타워 수로 압축 (모듈러스 스위칭)
+        std::vector<size_t> towers_before = {tower_count(term1), tower_count(term2), tower_count(term3)};
+        term1 = compact_ciphertext(cc, term1);
+        term2 = compact_ciphertext(cc, term2);
+        term3 = compact_ciphertext(cc, term3);
+        if (sweep_inputs.empty()) {
+            term_towers_before = towers_before;
+            term_towers_after = {tower_count(term1), tower_count(term2), tower_count(term3)};
+        }
         
         auto end_compute = std::chrono::high_resolution_clock::now();
         auto start_decrypt = std::chrono::high_resolution_clock::now();
 
         // ====== 복호화 ======
         Plaintext p_term1, p_term2, p_term3;
-        cc->Decrypt(keyPair.secretKey, term1, &p_term1);
-        cc->Decrypt(keyPair.secretKey, term2, &p_term2);
-        cc->Decrypt(keyPair.secretKey, term3, &p_term3);
+        traced_decrypt(cc, keyPair.secretKey, term1, &p_term1, "term1");
+        traced_decrypt(cc, keyPair.secretKey, term2, &p_term2, "term2");
+        traced_decrypt(cc, keyPair.secretKey, term3, &p_term3, "term3");
         
         auto end_decrypt = std::chrono::high_resolution_clock::now();
         auto end_total = std::chrono::high_resolution_clock::now();
@@ -109,6 +143,11 @@ int main() {
         auto decrypt_time = std::chrono::duration_cast<std::chrono::microseconds>(end_decrypt - start_decrypt).count() / 1000.0;
         auto total_time = std::chrono::duration_cast<std::chrono::microseconds>(end_total - start_total).count() / 1000.0;
 
+        sweep_inputs.push_back(x_scaled);
+        sweep_outputs.push_back(y_scaled);
+        sweep_total_ms += total_time;
+        sweep_encrypt_ms += encrypt_time;
+
         std::cout << deg << "\t" << x_input << "\t" << y_recovered << "\t" << y_true << "\t" << error 
                   << "\t" << t1_raw << "\t" << t2_raw << "\t" << t3_raw << "\t" << t1 << "\t" << t2 << "\t" << t3
                   << "\t" << std::fixed << std::setprecision(2) << encrypt_time 
@@ -117,5 +156,141 @@ int main() {
                   << "\t" << total_time << std::endl;
     }
 
+    // ====== 배치 모드 (슬롯 패킹) ======
+    // 모든 슬롯을 스윕 각도로 채워 한 번의 암호화/연산/복호화로 처리
+    const size_t slots = slot_count(cc);
+    std::vector<int64_t> batch_inputs(slots);
+    for (size_t i = 0; i < slots; i++) {
+        batch_inputs[i] = sweep_inputs[i % sweep_inputs.size()];
+    }
+
+    auto start_batch_encrypt = std::chrono::high_resolution_clock::now();
+    auto batch_cts = encrypt_batch(cc, keyPair.publicKey, batch_inputs);
+    auto end_batch_encrypt = std::chrono::high_resolution_clock::now();
+
+    // 같은 EvalMult 체인을 공용 평가기로 실행 (계수는 모든 슬롯에 브로드캐스트, 항은 EvalAdd 로 합산)
+    ScaledPolynomial poly;
+    poly.coeffs = {0, ic1, 0, ic3, 0, ic5};
+    poly.s = s;
+    poly.scale = denom * std::pow(s,5);
+    PolyEvaluator evaluator(cc, coeffs);
+    std::vector<Ciphertext<DCRTPoly>> batch_results;
+    auto start_batch_compute = std::chrono::high_resolution_clock::now();
+    for (const auto& ct_x : batch_cts) {
+        batch_results.push_back(evaluator.evaluate(ct_x, poly));
+    }
+    auto end_batch_compute = std::chrono::high_resolution_clock::now();
+
+    auto start_batch_decrypt = std::chrono::high_resolution_clock::now();
+    auto batch_outputs = decrypt_batch(cc, keyPair.secretKey, batch_results, batch_inputs.size());
+    auto end_batch_decrypt = std::chrono::high_resolution_clock::now();
+
+    size_t batch_mismatch = 0;
+    for (size_t i = 0; i < batch_outputs.size(); i++) {
+        if (batch_outputs[i] != centered_mod(sweep_outputs[i % sweep_outputs.size()], PlaintextModulus)) batch_mismatch++;
+    }
+
+    double batch_encrypt_ms = elapsed_ms(start_batch_encrypt, end_batch_encrypt);
+    double batch_compute_ms = elapsed_ms(start_batch_compute, end_batch_compute);
+    double batch_decrypt_ms = elapsed_ms(start_batch_decrypt, end_batch_decrypt);
+    double batch_total_ms = batch_encrypt_ms + batch_compute_ms + batch_decrypt_ms;
+
+    std::cout << "\n=== 배치 모드 (슬롯 " << slots << "개) ===" << std::endl;
+    std::cout << "모드\t값 개수\t암호화(ms)\t연산(ms)\t복호화(ms)\t총시간(ms)\t값당(ms)\t처리량(values/s)" << std::endl;
+    std::cout << "각도별\t" << sweep_inputs.size()
+              << "\t-\t-\t-\t" << sweep_total_ms
+              << "\t" << sweep_total_ms / sweep_inputs.size()
+              << "\t" << sweep_inputs.size() * 1000.0 / sweep_total_ms << std::endl;
+    std::cout << "배치\t" << batch_inputs.size()
+              << "\t" << batch_encrypt_ms << "\t" << batch_compute_ms << "\t" << batch_decrypt_ms
+              << "\t" << batch_total_ms
+              << "\t" << std::setprecision(6) << batch_total_ms / batch_inputs.size()
+              << "\t" << std::setprecision(2) << batch_inputs.size() * 1000.0 / batch_total_ms << std::endl;
+    std::cout << "각도별 결과와 불일치: " << batch_mismatch << " / " << batch_outputs.size() << std::endl;
+
+    // ====== 암호화 풀 효과 ======
+    // 같은 입력을 풀 없이 (MakePackedPlaintext + Encrypt) 다시 암호화해 스윕의 풀 암호화 시간과 비교
+    double direct_encrypt_ms = 0.0;
+    for (int64_t x_scaled : sweep_inputs) {
+        auto start_direct = std::chrono::high_resolution_clock::now();
+        auto ct_direct = cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext({x_scaled}));
+        direct_encrypt_ms += elapsed_ms(start_direct, std::chrono::high_resolution_clock::now());
+    }
+    const auto pool_stats = pool.stats();
+    std::cout << "\n=== 암호화 풀 (입력 " << sweep_inputs.size() << "개 평균) ===" << std::endl;
+    std::cout << "풀 없이 암호화(ms): " << direct_encrypt_ms / sweep_inputs.size() << std::endl;
+    std::cout << "풀 사용 암호화(ms): " << sweep_encrypt_ms / sweep_inputs.size() << std::endl;
+    std::cout << "풀 사용 " << pool_stats.taken << ", 빈 풀 " << pool_stats.misses << ", Enc(0) 생성 평균(ms): "
+              << (pool_stats.produced ? pool_stats.produce_ms / pool_stats.produced : 0.0) << std::endl;
+
+    // ====== 키 스위칭 (재선형화) 수 ======
+    std::cout << "\n=== 키 스위칭 ===" << std::endl;
+    std::cout << "각도별: 암호문당 2회 (즉시 재선형화 시 3회, 잎 x^5 는 3성분으로 복호화)" << std::endl;
+    std::cout << "배치 평가기: 암호문당 " << evaluator.stats().key_switches << "회 (잎 거듭제곱은 합계에서 한 번만 재선형화)" << std::endl;
+
+    // ====== 레벨 압축 효과 ======
+    // 압축하지 않은 결과와 최소 타워 수로 압축한 결과의 타워 수, 직렬화 크기, 복호화 시간 비교
+    evaluator.set_compaction(false);
+    auto ct_full = evaluator.evaluate(batch_cts[0], poly);
+    evaluator.set_compaction(true);
+    auto ct_compact = compact_ciphertext(cc, ct_full);
+
+    std::cout << "\n=== 레벨 압축 ===" << std::endl;
+    std::cout << "각도별 항 타워 수 (압축 전 -> 후):";
+    for (size_t i = 0; i < term_towers_before.size(); i++) {
+        std::cout << " term" << i + 1 << " " << term_towers_before[i] << " -> " << term_towers_after[i];
+    }
+    std::cout << std::endl;
+    std::cout << "결과\t타워\t크기(B)\t복호화(ms)" << std::endl;
+    for (const auto& entry : {std::make_pair("압축 전", ct_full), std::make_pair("압축 후", ct_compact)}) {
+        Plaintext p_out;
+        auto start_probe = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < 10; r++) cc->Decrypt(keyPair.secretKey, entry.second, &p_out);
+        double probe_ms = elapsed_ms(start_probe, std::chrono::high_resolution_clock::now()) / 10;
+        std::cout << entry.first << "\t" << tower_count(entry.second) << "\t" << ciphertext_bytes(entry.second)
+                  << "\t" << probe_ms << std::endl;
+    }
+
+    // ====== 계수 평문 캐시 효과 ======
+    // 같은 암호문으로 연산 단계만 반복: 매 반복 MakePackedPlaintext (기존 방식) vs CoeffStore
+    auto ct_probe = cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext({sweep_inputs.back()}));
+    double inline_ms = 0.0;
+    double cached_ms = 0.0;
+    for (size_t r = 0; r < sweep_inputs.size(); r++) {
+        auto start_inline = std::chrono::high_resolution_clock::now();
+        {
+            auto ct_x2 = cc->EvalMult(ct_probe, ct_probe);
+            auto ct_x3 = cc->EvalMult(ct_x2, ct_probe);
+            auto ct_x5 = cc->EvalMult(ct_x3, ct_x2);
+            int64_t ic3_mod = (ic3 < 0) ? (PlaintextModulus + ic3) : ic3;
+            int64_t ic5_mod = (ic5 < 0) ? (PlaintextModulus + ic5) : ic5;
+            auto term1 = cc->EvalMult(ct_probe, cc->MakePackedPlaintext({ic1}));
+            auto term2 = cc->EvalMult(ct_x3, cc->MakePackedPlaintext({ic3_mod}));
+            auto term3 = cc->EvalMult(ct_x5, cc->MakePackedPlaintext({ic5_mod}));
+        }
+        auto end_inline = std::chrono::high_resolution_clock::now();
+        {
+            auto ct_x2 = cc->EvalMult(ct_probe, ct_probe);
+            auto ct_x3 = cc->EvalMult(ct_x2, ct_probe);
+            auto ct_x5 = cc->EvalMult(ct_x3, ct_x2);
+            auto term1 = cc->EvalMult(ct_probe, coeffs->scalar(ic1, ct_probe));
+            auto term2 = cc->EvalMult(ct_x3, coeffs->scalar(ic3, ct_x3));
+            auto term3 = cc->EvalMult(ct_x5, coeffs->scalar(ic5, ct_x5));
+        }
+        auto end_cached = std::chrono::high_resolution_clock::now();
+        inline_ms += elapsed_ms(start_inline, end_inline);
+        cached_ms += elapsed_ms(end_inline, end_cached);
+    }
+    inline_ms /= sweep_inputs.size();
+    cached_ms /= sweep_inputs.size();
+
+    std::cout << "\n=== 계수 평문 캐시 (반복 " << sweep_inputs.size() << "회 평균) ===" << std::endl;
+    std::cout << "매번 인코딩 연산(ms): " << inline_ms << std::endl;
+    std::cout << "캐시 사용 연산(ms): " << cached_ms << std::endl;
+    std::cout << "감소: " << inline_ms - cached_ms << " ms (" << std::setprecision(1)
+              << (inline_ms - cached_ms) / inline_ms * 100.0 << "%)" << std::endl;
+    std::cout << "캐시 적중/인코딩: " << coeffs->hits() << " / " << coeffs->misses()
+              << ", 총 인코딩 시간(ms): " << std::setprecision(2) << coeffs->encode_ms() << std::endl;
+
     return 0;
 } 
\ No newline at end of file
@@ -3,39 +3,49 @@
 #include <cmath>
 #include <iomanip>
 
+#include "he_poly_eval.h"
+#include "he_shadow.h"
+
 int main() {
     // ====== 파라미터 ======
     const int64_t s = 50;         // 스케일링 상수
     const int64_t denom = 6;     // 정수화 분모
+    const int64_t PlaintextModulus = 7340033; // sin_taylor_third 와 같은 모듈러스 (감김 확인용)
 
-    std::cout << std::fixed << std::setprecision(6);
-    std::cout << "각도(도)\tx_input(rad)\t근사값\t실제값\t오차" << std::endl;
+    // ====== 테일러 계수 (정수화) ======
+    // ic1 = round(c1 * denom * s^2), ic3 = round(c3 * denom * s^0)
+    const ScaledPolynomial poly = make_taylor_sin(3, s, denom);
 
+    std::vector<int> degs;
+    std::vector<int64_t> inputs;
     for (int deg = -90; deg <= 90; deg += 10) {
         double x_input = deg * M_PI / 180.0;
-        int64_t x_scaled = static_cast<int64_t>(std::round(s * x_input));
+        degs.push_back(deg);
+        inputs.push_back(static_cast<int64_t>(std::round(s * x_input)));
+    }
 
-        // ====== 테일러 계수 (정수화) ======
-        const double c1 = 1.0;
-        const double c3 = -1.0/6.0;
-        int64_t ic1 = static_cast<int64_t>(std::round(c1 * denom * std::pow(s,2)));
-        int64_t ic3 = static_cast<int64_t>(std::round(c3 * denom * std::pow(s,0)));
+    // ====== 항별 연산 ======
+    // int64 곱 x_scaled^3 대신 그림자 평가로 계산: 정확한 y_scaled 와 함께 (-t/2, t/2) 를 넘는 입력을 표시
+    const ShadowBatch shadow = shadow_evaluate(poly, inputs, PlaintextModulus);
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "각도(도)\tx_input(rad)\t근사값\t실제값\t오차\t감김" << std::endl;
 
-        // ====== 항별 연산 ======
-        int64_t x3 = x_scaled * x_scaled * x_scaled;
-        int64_t term1 = ic1 * x_scaled;
-        int64_t term2 = ic3 * x3;
-        int64_t y_scaled = term1 + term2;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        double x_input = degs[i] * M_PI / 180.0;
+        int64_t y_scaled = shadow.expected[i];
 
         // ====== 역스케일링 ======
-        double y_recovered = static_cast<double>(y_scaled) / (denom * std::pow(s,3));
+        double y_recovered = static_cast<double>(y_scaled) / poly.scale;
 
         // ====== 실제값 및 오차 ======
         double y_true = std::sin(x_input);
         double error = std::abs(y_true - y_recovered);
 
         // ====== 결과 출력 ======
-        std::cout << deg << "\t" << x_input << "\t" << y_recovered << "\t" << y_true << "\t" << error << std::endl;
+        std::cout << degs[i] << "\t" << x_input << "\t" << y_recovered << "\t" << y_true << "\t" << error
+                  << "\t" << ((shadow.flags[i] & ShadowOutputWrap) ? "X" : "O") << std::endl;
     }
+    std::cout << "감김 입력: " << shadow.output_wraps << " / " << inputs.size() << std::endl;
     return 0;
-} 
\ No newline at end of file
+}
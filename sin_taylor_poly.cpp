@@ -0,0 +1,162 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+#include "he_common.h"
+#include "he_context_cache.h"
+#include "he_poly_eval.h"
+#include "he_shadow.h"
+#include "he_tune.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_taylor_poly [차수=7] [s=자동] [PlaintextModulus=593779228673] [RingDim=16384]
+//        ./sin_taylor_poly --config sin_tune.cfg   (sin_tune 이 고른 파라미터 사용)
+int main(int argc, char* argv[]) {
+    // ====== 파라미터 ======
+    TunedConfig tuned;
+    const std::string config_path = arg_str(argc, argv, "--config", "");
+    const bool from_config = !config_path.empty();
+    if (from_config && !load_tuned_config(config_path, tuned)) {
+        std::cerr << "설정 파일을 읽을 수 없습니다: " << config_path << std::endl;
+        return 1;
+    }
+
+    const long degree_arg = from_config ? static_cast<long>(tuned.degree) : (argc > 1) ? std::strtol(argv[1], nullptr, 10) : 7;
+    if (degree_arg < 1) {
+        std::cerr << "차수는 1 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    const size_t degree = degree_arg;
+    int64_t s = from_config ? tuned.s : (argc > 2) ? std::strtoll(argv[2], nullptr, 10) : 0;
+    const int64_t PlaintextModulus = from_config ? static_cast<int64_t>(tuned.plaintext_modulus)
+                                   : (argc > 3) ? std::strtoll(argv[3], nullptr, 10) : 593779228673;
+    const uint32_t RingDim = from_config ? tuned.ring_dim : (argc > 4) ? std::strtoul(argv[4], nullptr, 10) : 16384;
+
+    // 정수화 분모 = n! (기존 3차: 6, 5차: 120 과 동일), 설정 파일은 튜너가 고른 값
+    int64_t denom = 1;
+    for (size_t k = 2; k <= degree; k++) denom *= k;
+    if (from_config) denom = tuned.denom;
+
+    // s 미지정 시: 계수가 int64 에 들어가고 180도 입력까지 y_scaled 가 PlaintextModulus/2 안에 들어가는 가장 큰 s (최대 50)
+    if (s == 0) {
+        for (s = 50; s > 1; s--) {
+            if (std::pow(static_cast<long double>(s), degree - 1) * denom > 4e18L) continue;
+            if (output_fits(make_taylor_sin(degree, s, denom), std::llround(s * M_PI), PlaintextModulus)) break;
+        }
+    }
+    const ScaledPolynomial poly = make_taylor_sin(degree, s, denom);
+    const uint32_t depth = required_depth(poly.degree());
+
+    std::cout << "=== " << poly.degree() << "차 근사 파라미터 정보 ===" << std::endl;
+    std::cout << "PlaintextModulus: " << PlaintextModulus << " (약 " << std::log2(PlaintextModulus) << " 비트)" << std::endl;
+    std::cout << "s: " << s << ", denom: " << denom << ", 곱셈 뎁스: " << depth << std::endl;
+    for (size_t k = 1; k <= poly.degree(); k += 2) {
+        std::cout << "ic" << k << ": " << poly.coeffs[k] << std::endl;
+    }
+    std::cout << "PlaintextModulus/2: " << PlaintextModulus/2 << std::endl;
+    std::cout << "===============================" << std::endl;
+
+    // ====== 암호화 파라미터 설정 ======
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(PlaintextModulus);
+    parameters.SetMultiplicativeDepth(depth);
+    parameters.SetSecurityLevel(from_config ? tuned.security : SecurityLevel::HEStd_NotSet);
+    parameters.SetRingDim(RingDim);
+
+    // 컨텍스트 + 키 (디스크 캐시가 있으면 로드)
+    auto he = load_or_create_context(parameters);
+    auto cc = he.cc;
+    auto keyPair = he.keyPair;
+    std::cout << "컨텍스트/키 준비: " << he.setup_ms << " ms (" << (he.from_cache ? "캐시 로드" : "새로 생성") << ")" << std::endl;
+
+    // ====== 입력: -180 ~ 180도, 10도 간격을 하나의 암호문 슬롯에 패킹 ======
+    std::vector<int> degs;
+    std::vector<int64_t> inputs;
+    // 설정 파일을 쓰면 튜너가 보장한 입력 범위 안의 각도만 사용
+    const int deg_limit = from_config ? static_cast<int>(std::floor(tuned.x_max * 180.0 / M_PI)) : 180;
+    for (int deg = -deg_limit / 10 * 10; deg <= deg_limit; deg += 10) {
+        degs.push_back(deg);
+        inputs.push_back(static_cast<int64_t>(std::round(s * deg * M_PI / 180.0)));
+    }
+
+    // ====== 그림자 평가: 결과가 감기는 입력이 있으면 암호문 연산 전에 거부 ======
+    const ShadowBatch shadow = shadow_evaluate(poly, inputs, PlaintextModulus);
+    std::cout << "그림자 평가: " << shadow.ms << " ms (" << inputs.size() << "개), 감김 " << shadow.output_wraps
+              << ", 넓은 항 " << shadow.wide_terms << std::endl;
+    if (!shadow.ok()) {
+        std::cerr << "결과가 PlaintextModulus/2 를 넘는 입력이 있어 배치를 거부합니다" << std::endl;
+        return 1;
+    }
+
+    auto start_encrypt = std::chrono::high_resolution_clock::now();
+    auto ct_x = encrypt_batch(cc, keyPair.publicKey, inputs);
+    auto end_encrypt = std::chrono::high_resolution_clock::now();
+
+    // ====== 암호공간 연산: 거듭제곱 트리 + 계수 곱 + EvalAdd 합산 ======
+    PolyEvaluator evaluator(cc);
+    std::vector<Ciphertext<DCRTPoly>> ct_y;
+    auto start_compute = std::chrono::high_resolution_clock::now();
+    for (const auto& ct : ct_x) {
+        ct_y.push_back(evaluator.evaluate(ct, poly));
+    }
+    auto end_compute = std::chrono::high_resolution_clock::now();
+    const PolyEvalStats stats = evaluator.stats();
+
+    // ====== 비교: 모든 거듭제곱을 즉시 재선형화 ======
+    PolyEvaluator eager(cc, evaluator.coeffs());
+    eager.set_lazy_relin(false);
+    std::vector<Ciphertext<DCRTPoly>> ct_y_eager;
+    auto start_eager = std::chrono::high_resolution_clock::now();
+    for (const auto& ct : ct_x) {
+        ct_y_eager.push_back(eager.evaluate(ct, poly));
+    }
+    auto end_eager = std::chrono::high_resolution_clock::now();
+    const bool eager_match = decrypt_batch(cc, keyPair.secretKey, ct_y_eager, inputs.size()) ==
+                             decrypt_batch(cc, keyPair.secretKey, ct_y, inputs.size());
+
+    // ====== 복호화 (암호문당 1회) ======
+    auto start_decrypt = std::chrono::high_resolution_clock::now();
+    auto outputs = decrypt_batch(cc, keyPair.secretKey, ct_y, inputs.size());
+    auto end_decrypt = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "각도(도)\tx_input(rad)\t근사값\t실제값\t오차\ty_raw\ty_plain" << std::endl;
+    double max_error = 0.0;
+    const size_t mismatch = shadow_mismatches(shadow, outputs).size();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        double x_input = degs[i] * M_PI / 180.0;
+        int64_t y_plain = shadow.expected[i];
+        double y_recovered = static_cast<double>(outputs[i]) / poly.scale;
+        double y_true = std::sin(x_input);
+        double error = std::abs(y_true - y_recovered);
+        max_error = std::max(max_error, error);
+        std::cout << degs[i] << "\t" << x_input << "\t" << y_recovered << "\t" << y_true << "\t" << error
+                  << "\t" << outputs[i] << "\t" << y_plain << std::endl;
+    }
+
+    std::cout << "\n=== 성능 요약 ===" << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "암호화(ms): " << elapsed_ms(start_encrypt, end_encrypt) << std::endl;
+    std::cout << "연산(ms): " << elapsed_ms(start_compute, end_compute) << std::endl;
+    std::cout << "복호화(ms): " << elapsed_ms(start_decrypt, end_decrypt) << std::endl;
+    std::cout << "암호문 곱셈: " << stats.ct_mults << ", 평문 곱셈: " << stats.pt_mults
+              << ", 덧셈: " << stats.additions << ", 거듭제곱 뎁스: " << stats.power_depth << std::endl;
+    std::cout << "항 레벨 그룹: " << stats.level_groups << ", 결과 타워 수 (압축 전 -> 후): "
+              << stats.towers_before << " -> " << stats.towers_after << std::endl;
+    std::cout << "암호문당 복호화: 1회 (항별 복호화 시 " << stats.pt_mults << "회)" << std::endl;
+    const double lazy_ms = elapsed_ms(start_compute, end_compute);
+    const double eager_ms = elapsed_ms(start_eager, end_eager);
+    std::cout << "키 스위칭 (암호문당): 지연 재선형화 " << stats.key_switches << "회, 즉시 재선형화 "
+              << eager.stats().key_switches << "회" << std::endl;
+    std::cout << "연산(ms): 지연 " << lazy_ms << ", 즉시 " << eager_ms << ", 절약 " << eager_ms - lazy_ms
+              << " (결과 " << (eager_match ? "일치" : "불일치") << ")" << std::endl;
+    std::cout << std::setprecision(6) << "최대 오차: " << max_error
+              << ", 평문 파이프라인과 불일치: " << mismatch << " / " << inputs.size() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <openfhe/pke/openfhe.h>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+
+#include "he_common.h"
+#include "he_tune.h"
+
+using namespace lbcrypto;
+
+// 사용법: ./sin_tune [--x-max-deg 180] [--max-error 0.01] [--security notset|128|192|256]
+//                   [--max-degree 9] [--ring 4096] [--measure] [--output sin_tune.cfg]
+// 입력 범위와 허용 오차를 만족하고 wraparound 가 없는 (차수, s, denom, t) 를 정수 모의로 찾고,
+// 보안 수준에 맞는 링 차원/뎁스를 붙여 비용이 가장 낮은 설정을 파일로 출력한다.
+int main(int argc, char* argv[]) {
+    TuneTarget target;
+    target.x_max = arg_double(argc, argv, "--x-max-deg", 180.0) * M_PI / 180.0;
+    target.max_error = arg_double(argc, argv, "--max-error", 0.01);
+    target.security = parse_security(arg_str(argc, argv, "--security", "notset"));
+    target.max_degree = arg_int(argc, argv, "--max-degree", 9);
+    target.min_ring_dim = arg_int(argc, argv, "--ring", 4096);
+    const bool measure = arg_flag(argc, argv, "--measure");
+    const std::string output_path = arg_str(argc, argv, "--output", "sin_tune.cfg");
+
+    std::cout << "입력 범위: |x| <= " << target.x_max << " rad, 허용 오차: " << target.max_error
+              << ", 보안: " << security_name(target.security)
+              << ", 비용: " << (measure ? "실측" : "모델") << std::endl;
+
+    auto candidates = tune_parameters(target, measure);
+    if (candidates.empty()) {
+        std::cout << "조건을 만족하는 파라미터가 없습니다 (허용 오차를 늘리거나 --max-degree 를 올려 보세요)" << std::endl;
+        return 1;
+    }
+
+    std::cout << std::fixed;
+    std::cout << "\n차수\ts\tdenom\tPlaintextModulus\tt비트\t링차원\t뎁스\t타워\t최대오차\t모델비용\t실측(ms)" << std::endl;
+    for (const auto& c : candidates) {
+        std::cout << c.degree << "\t" << c.s << "\t" << c.denom << "\t" << c.plaintext_modulus
+                  << "\t" << std::setprecision(1) << std::log2(static_cast<double>(c.plaintext_modulus))
+                  << "\t" << c.ring_dim << "\t" << c.depth << "\t" << c.towers
+                  << "\t" << std::setprecision(6) << c.max_error
+                  << "\t" << std::setprecision(2) << c.model_cost << "\t";
+        if (c.measured_ms >= 0.0) std::cout << c.measured_ms;
+        else std::cout << "-";
+        std::cout << std::endl;
+    }
+
+    const auto& best = candidates.front();
+    write_tuned_config(output_path, best);
+    std::cout << "\n선택: " << best.degree << "차, s = " << best.s << ", denom = " << best.denom
+              << ", PlaintextModulus = " << best.plaintext_modulus << ", RingDim = " << best.ring_dim
+              << ", 뎁스 = " << best.depth << std::endl;
+    std::cout << "설정 파일: " << output_path << " (./sin_taylor_poly --config " << output_path << ")" << std::endl;
+    return 0;
+}